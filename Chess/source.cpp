@@ -1,27 +1,53 @@
-/* ... --> advapi32.lib, gdi32.lib, kernel32.lib, shell32.lib, user32.lib */
+/* ... --> advapi32.lib, gdi32.lib, kernel32.lib, shell32.lib, user32.lib, ws2_32.lib */
 /* Definition > ... */
 #ifndef MOUSEEVENTF_FROMTOUCH
 # define MOUSEEVENTF_FROMTOUCH 0xFF515700
 #endif
 #undef UNICODE
 
+#if defined(_MSC_VER)
+# define CACHE_ALIGNED __declspec(align(64))
+# define THREAD_LOCAL  __declspec(thread)
+#else
+# define CACHE_ALIGNED __attribute__((aligned(64)))
+# define THREAD_LOCAL  __thread
+#endif
+
+#if defined(__AVX2__)
+# define SIMD_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+# define SIMD_SSE2
+#endif
+
 /* Import */
 // : [C Standard Library]
 #include <stdbool.h> // Standard Boolean
 #include <stdint.h>  // Standard Integers
 
 // : [C++ Standard Library]
+#include <cctype>  // C Character Type
+#include <cmath>   // C Mathematics
 #include <cstddef> // C Standard Definitions
 #include <csignal> // C Signal
 #include <cstdio>  // C Standard Input/ Output
 #include <cstdlib> // C Standard Library
+#include <cstring> // C String
+
+// : [Intrinsics]
+#if defined(SIMD_AVX2)
+# include <immintrin.h> // AVX2
+#elif defined(SIMD_SSE2)
+# include <emmintrin.h> // SSE2
+#endif
 
 // : [Windows API]
+#include <winsock2.h> // Windows Sockets ->> Before `windows.h`, which would otherwise include the older `winsock.h`
 #include <windows.h>  // Windows
 #include <windowsx.h> // Windows Extensions
 
 /* Phase > ... */
 static void INITIATE ();
+       void RENDER   ();
        void RESET    ();
        void TERMINATE();
        void UPDATE   ();
@@ -47,7 +73,27 @@ struct bit {
         operator uintmax_t() const { return this -> value; }
 };
 
-// : Piece ->> Pointer-to-implementation structure; Implementation is `Game::MEMORY`
+// : Framebuffer ->> Top-down view over 32-bit pixels; Bottom-up bitmaps get a negative `stride` so rows are always addressed the same way
+struct Framebuffer {
+    RECT    clip; // ->> Writes outside are dropped; Checked once per span, never per pixel
+    int     height;
+    UINT32 *memory; // ->> Top row
+    long    stride; // ->> in pixels
+    int     width;
+
+    Framebuffer();
+    Framebuffer(UINT32[], long const, int const, int const);
+    Framebuffer(VOID* const, BITMAPINFOHEADER const&);
+
+    // ...
+    void    blit   (int const, int const, UINT32 const[], long const, int const, int const, bool const = false);
+    void    fill   (int const, int, int, UINT32 const);
+    UINT32* getRow (int const) const;
+    void    setClip(int const, int const, int const, int const);
+    void    write  (int const, int, UINT32 const[], int const, bool const = false);
+};
+
+// : Piece ->> Pointer-to-implementation structure; Implementation is `Game::CONTEXT -> memory`
 struct Piece {
     typedef struct Enumeration {
         private: unsigned char value : 5;
@@ -91,6 +137,15 @@ struct Piece {
     void    setRow          (bit<3u> const);
 };
 
+// : Timer ->> Scoped timer around a rendering phase; Inert unless `Program::Profiler::ENABLED`
+struct Timer {
+    unsigned char phase;
+    LARGE_INTEGER start;
+
+    Timer(unsigned char const);
+    ~Timer();
+};
+
 /* Definition > ... */
 typedef Piece Bishop, King, Knight, Pawn, Queen, Rook;
 typedef Piece::Player Player;
@@ -102,19 +157,141 @@ typedef Piece::Player Player;
 */
 namespace Game {
     namespace Board {
-        static DWORD          COLOR  = 0x000000u;
-        static int            LEFT   = 0;
-        static unsigned short HEIGHT = 0u;
-        static int            TOP    = 0;
-        static unsigned short WIDTH  = 0u;
+        static DWORD          COLOR         = 0x000000u;
+        static int            LEFT          = 0;
+        static unsigned short HEIGHT        = 0u;
+        static UINT32        *LAYER         = NULL; // ->> Board & (un-highlighted) tiles; Redrawn only once `LAYER_INVALID`
+        static bool           LAYER_INVALID = true; // ->> Set whenever the board geometry or tile colors change
+        static int            TOP           = 0;
+        static unsigned short WIDTH         = 0u;
+    }
+
+    namespace Destinations /* ->> Per-thread legal-destination masks for the position hashed `HASH` */ {
+        static THREAD_LOCAL uint64_t COMPUTED  = 0u; // ->> Bit per origin tile
+        static THREAD_LOCAL uint64_t HASH      = 0u;
+        static THREAD_LOCAL uint64_t MASKS[64] = {0};
+    }
+
+    namespace Evaluation /* ->> Linear in material, piece-square & mobility features, in centipawns for the light player; Fitted offline with `--tune` */ {
+        static unsigned short const MATERIAL      = 0u;  // ->> `+ Piece::Type`
+        static unsigned short const MOBILITY      = 6u;  // ->> `+ Piece::Type`; Weighs each pseudo-legal move
+        static unsigned short const SQUARES       = 12u; // ->> `+ (Piece::Type × 64) + tile`; Dark tiles are mirrored onto light ones
+        static unsigned short const FEATURE_COUNT = SQUARES + (6u * 64u);
+        static unsigned char const  FEATURE_LIMIT = 32u * 3u; // ->> per position
+
+        static float WEIGHTS[FEATURE_COUNT] = {/* ->> Bishop, King, Knight, Pawn, Queen, Rook */ 330.0f, 0.0f, 320.0f, 100.0f, 900.0f, 500.0f};
+    }
+
+    namespace Journal /* ->> Memory-mapped, append-only log of every move with a state snapshot every `SNAPSHOT_INTERVAL` moves; The last game resumes from its latest snapshot on start */ {
+        static std::size_t const   CAPACITY          = 1048576u; // ->> Restarts from a snapshot once full
+        static std::size_t const   HEADER_SIZE       = 8u; // ->> `MAGIC`, then the offset of the latest snapshot
+        static char const          LEGACY_MAGIC[4]   = {'C', 'H', 'J', '1'}; // ->> Turn in the low bit of state byte 34 instead of 17; Migrated on open
+        static char const          MAGIC[4]          = {'C', 'H', 'J', '2'};
+        static unsigned char const MOVE              = 0x01u; // ->> Record: kind, `from`, `to`, checksum
+        static unsigned char const SNAPSHOT          = 0x02u; // ->> Record: kind, 35-byte state, checksum
+        static unsigned char const SNAPSHOT_INTERVAL = 32u;
+
+        static HANDLE         FILE         = NULL;
+        static HANDLE         FILE_MAPPING = NULL;
+        static char const    *FILE_NAME    = NULL;
+        static unsigned char  MOVE_COUNT   = 0u; // ->> since the last snapshot
+        static std::size_t    SIZE         = 0u;
+        static unsigned char *VIEW         = NULL;
+
+        // ...
+        static bool     append   (unsigned char const, unsigned char const);
+        static uint32_t checksum (unsigned char const, std::size_t const, std::size_t const);
+        static bool     migrate  ();
+        static bool     open     ();
+        static void     setLatest(std::size_t const);
+        static bool     snapshot ();
+        static bool     write    (unsigned char const, unsigned char const[], std::size_t const);
+    }
+
+    namespace Network /* ->> Efficiently updatable network: Every non-king piece, keyed on a player's king tile, feeds that player's `HIDDEN_COUNT`-wide accumulator; Accumulators are patched by `Piece::setPosition(...)` & `Piece::capture(...)` so a move costs a few vector adds */ {
+        static unsigned short const FEATURE_COUNT = 64u * 10u * 64u; // ->> King tile × (five non-king types × own or opposing) × tile
+        static unsigned short const HIDDEN_COUNT  = 128u; // ->> per player; Multiple of 16 lanes
+        static unsigned char const  LAYER_COUNT   = 32u;
+        static char const           MAGIC[4]      = {'C', 'H', 'N', '1'};
+        static unsigned char const  OUTPUT_SCALE  = 16u; // ->> Output units per centipawn
+        static unsigned char const  WEIGHT_SHIFT  = 6u;  // ->> Fractional bits of `LAYER_WEIGHTS`
+
+        #if defined(SIMD_AVX2)
+          static char const INSTRUCTIONS[] = "AVX2";
+        #elif defined(SIMD_SSE2)
+          static char const INSTRUCTIONS[] = "SSE2";
+        #else
+          static char const INSTRUCTIONS[] = "scalar";
+        #endif
+
+        static int16_t     FEATURE_BIASES [HIDDEN_COUNT]                   = {0};
+        static int16_t    *FEATURE_WEIGHTS                                 = NULL; // ->> `FEATURE_COUNT × HIDDEN_COUNT`
+        static char const *FILE_NAME                                       = NULL;
+        static int32_t     LAYER_BIASES   [LAYER_COUNT]                    = {0};
+        static int16_t     LAYER_WEIGHTS  [LAYER_COUNT][HIDDEN_COUNT * 2u] = {{0}}; // ->> Stored as `int8_t`; Widened once loaded
+        static bool        LOADED                                          = false;
+        static int32_t     OUTPUT_BIAS                                     = 0;
+        static int16_t     OUTPUT_WEIGHTS [LAYER_COUNT]                    = {0}; // ->> Stored as `int8_t`
+
+        // ...
+        static void     accumulate(int16_t[], int16_t const[], bool const);
+        static void     clamp     (int16_t[], int16_t const[], unsigned short const);
+        static int32_t  dot       (int16_t const[], int16_t const[], unsigned short const);
+        static int      evaluate  ();
+        static unsigned getFeature(unsigned char const, unsigned char const, unsigned char const, unsigned char const);
+        static bool     load      ();
+        static void     refresh   ();
+        static void     update    (unsigned char const, unsigned char const, unsigned char const);
+    }
+
+    namespace Pieces /* ->> Mapped directly from `ATLAS_FILE_NAME` if it was built by `--atlas`, else from `BITMAP_FILE_NAME`; Bitmap rows are addressed top-down through (a possibly negative) `BITMAP.bmWidthBytes` */ {
+        typedef struct AtlasSize { uint16_t height, width; uint32_t offset; } AtlasSize; // ->> Piece size; `offset` to its twelve `AtlasSprite`s, by player then type
+        typedef struct AtlasSprite { uint16_t height, left, top, width; uint32_t offset; } AtlasSprite; // ->> Trimmed to its opaque pixels; `offset` to its premultiplied rows
+
+        static char const ATLAS_MAGIC[4] = {'C', 'H', 'A', '1'}; // ->> then little-endian `uint32_t` count, `AtlasSize`s, `AtlasSprite`s & pixels, all 4-byte aligned
+
+        static HANDLE             ATLAS_FILE          = NULL;
+        static HANDLE             ATLAS_FILE_MAPPING  = NULL;
+        static LPCSTR             ATLAS_FILE_NAME     = NULL;
+        static DWORD              ATLAS_FILE_SIZE     = 0u;
+        static LPVOID             ATLAS_FILE_VIEW     = NULL;
+        static BITMAP             BITMAP              = ::BITMAP();
+        static HANDLE             BITMAP_FILE         = NULL;
+        static HANDLE             BITMAP_FILE_MAPPING = NULL;
+        static LPCSTR             BITMAP_FILE_NAME    = NULL;
+        static LPVOID             BITMAP_FILE_VIEW    = NULL;
+        static BYTE const        *BITMAP_MEMORY       = NULL;
+        static UINT32             BITMAP_PALETTE[256] = {0};
+        static UINT32            *LAYER               = NULL; // ->> Sprites scaled from the bitmap or the nearest atlas size, if the atlas lacks the piece size
+        static bool               LAYER_INVALID       = true;
+        static AtlasSprite        LAYER_SPRITES[12];
+        static AtlasSprite const *SPRITES             = NULL; // ->> per player & type at the piece size; Within the atlas or `LAYER_SPRITES`
+        static BYTE const        *SPRITES_MEMORY      = NULL; // ->> `AtlasSprite::offset` is from it
+
+        // ...
+        static bool loadAtlas ();
+        static bool loadBitmap();
     }
 
-    namespace Pieces {
-        static BITMAP  BITMAP                       = ::BITMAP();
-        static LPCSTR  BITMAP_FILE_NAME             = NULL;
-        static HDC     BITMAP_DEVICE_CONTEXT_HANDLE = NULL;
-        static HBITMAP BITMAP_HANDLE                = NULL;
-        static UINT32 *BITMAP_MEMORY                = NULL;
+    namespace Replay /* ->> Every ply as a varint-framed delta of the changed state bytes; A keyframe of the full state every `KEYFRAME_INTERVAL` plies bounds how many deltas a seek replays */ {
+        static unsigned char const KEYFRAME_INTERVAL  = 32u;
+        static unsigned char const MOVELESS           = 0xFFu; // ->> `from`, `to` of the opening keyframe
+
+        static std::size_t         CAPACITY           = 0u;
+        static std::size_t        *KEYFRAMES          = NULL; // ->> `STREAM` offset of the keyframe for ply `n × KEYFRAME_INTERVAL`
+        static std::size_t         KEYFRAME_CAPACITY  = 0u;
+        static std::size_t         OFFSET             = 0u; // ->> `STREAM` offset just past the shown ply
+        static unsigned long       PLY                = 0uL; // ->> Shown ply; Behind `PLY_COUNT` only while seeking
+        static unsigned long       PLY_COUNT          = 0uL;
+        static std::size_t         SIZE               = 0u;
+        static unsigned char       STATE[/* 275 ÷ 8 */ 35] = {0}; // ->> at `PLY`, i.e.: what the next delta is taken against
+        static unsigned char      *STREAM             = NULL;
+
+        // ...
+        static void apply (unsigned char[], unsigned char const[], std::size_t const);
+        static bool begin ();
+        static bool record(unsigned char const, unsigned char const);
+        static bool seek  (unsigned long const);
     }
 
     namespace Tiles {
@@ -134,8 +311,34 @@ namespace Game {
         static bool                SELECTED          = false;
     }
 
-    // ...
-    static bit<8u> MEMORY[/* 275 ÷ 8 */ 35] = {0};
+    // ... ->> Instanced game state; `Piece`s address whichever context the calling thread has made `CONTEXT`
+    typedef struct Context {
+        bit<8u>         memory[/* 275 ÷ 8 */ 35];
+        DWORD           clock[2]; // ->> Remaining milliseconds per player
+        uint64_t        hash;     // ->> of `memory`; Refreshed by `rehash()`
+        struct Context *next;     // ->> Free list link while released
+
+        int16_t         accumulators[2][Network::HIDDEN_COUNT]; // ->> per `Player`
+        unsigned char   accumulated; // ->> Bit per `Player` whose accumulator is current; Cleared wherever `memory` is overwritten wholesale
+        unsigned char   kings[2];    // ->> Tile each accumulator is keyed on
+    } Context;
+
+    namespace Contexts /* ->> One contiguous arena for every hosted game; Released contexts are recycled before it grows */ {
+        static std::size_t   CAPACITY = 0u;
+        static std::size_t   COUNT    = 0u; // ->> Handed out from the arena so far, released or not
+        static Context      *FREE     = NULL;
+        static LONG volatile LOCK     = 0;
+        static Context      *MEMORY   = NULL;
+    }
+
+    static Context                DEFAULT = Context(); // ->> The windowed game
+    static THREAD_LOCAL Context  *CONTEXT = &DEFAULT;
+
+    // ... ->> Contexts
+    static Context* acquireContext ();
+    static void     releaseContext (Context* const);
+    static uint64_t rehash         ();
+    static bool     reserveContexts(std::size_t const);
 
     // ... ->> Address memory segments
     static bit<8u>* addressCapturedOfficerData();
@@ -146,18 +349,184 @@ namespace Game {
     static bit<8u>* addressPromotedPawnData   ();
     static bit<8u>* addressTurnData           ();
 
+    // ... ->> Render layers
+    static void drawBevel     (Framebuffer&, int const, int const, int const, int const, UINT32 const);
+    static void drawBoardLayer();
+    static void drawPieceLayer();
+    static void drawTileBevel (unsigned char const, DWORD const);
+
     // ...
-    static Piece          getFirstPiece();
-    static Piece          getNextPiece (Piece const);
-    static Piece          getPiece     (Player const, Piece::Type const, bit<3u> const = 0u);
+    static float          evaluate           (unsigned char const[]);
+    static void           getBoard           (unsigned char[]);
+    static uint64_t       getDestinations    (unsigned char const);
+    static unsigned char  getFeatures        (unsigned char const[], unsigned short[], signed char[]);
+    static Piece          getFirstPiece      ();
+    static uint64_t       getMoves           (unsigned char const[], unsigned char const, bool const = false);
+    static Piece          getNextPiece       (Piece const);
+    static Piece          getPiece           (Player const, Piece::Type const, bit<3u> const = 0u);
+    static DWORD          getPieceBitmapColor(unsigned short const, unsigned short const);
+    static unsigned char  getTile            (int const, int const);
     static unsigned short getTileHeight();
     static unsigned short getTileWidth ();
     static Player         getTurn      ();
+    static bool           isAttacked   (unsigned char const[], unsigned char const, bool const);
+    static bool           move         (unsigned char const, unsigned char const);
+    static bool           play         (unsigned char const, unsigned char const);
+    static bool           setHover     (int const, int const);
     static void           setPlayerTurn(Player const);
 }
 
 // : Program
 namespace Program {
+    namespace Analysis /* ->> Toggled with F2: Searches the shown position on `THREAD` while the human thinks, then ponders the reply it predicts so that reply is answered at once; Results are triple-buffered like `Render` frames */ {
+        typedef struct Snapshot {
+            bool          complete; // ->> Searched to `DEPTH_LIMIT` or until its deadline
+            unsigned char depth;    // ->> Last completed; Zero if none yet
+            LONG          job;      // ->> `GENERATION` it was searched for
+            uint64_t      hash;     // ->> of the searched position
+            unsigned char move [2]; // ->> Best `from`, `to`
+            unsigned long nodes;
+            unsigned char reply[2]; // ->> Predicted answer to `move`
+            int           score;    // ->> in centipawns for the mover
+        } Snapshot;
+
+        static unsigned char const DEPTH_LIMIT = 4u;
+        static LONG const          FRESH       = 0x4; // ->> Set on `READY` until `UPDATE()` takes it
+        static int const           MATE        = 30000;
+        static DWORD const         THINK_TIME  = 2000u; // ->> Milliseconds per engine move, unless `DEPTH_LIMIT` is reached first
+
+        static unsigned char BACK         = 0u; // ->> Written on `THREAD` only
+        static LONG volatile DEADLINE     = 0; // ->> Tick count the running search stops at, once it has a move; Zero if none
+        static bool          ENABLED      = false;
+        static unsigned char FRONT        = 2u; // ->> Read on `Simulation::THREAD` only
+        static LONG volatile GENERATION   = 0; // ->> Bumped by every `post(...)`; Any search of an older position unwinds
+        static LONG volatile LOCK         = 0; // ->> Spin lock over `ROOT`
+        static Player        PLAYER       = 0u; // ->> Played by the engine; The one not to move when F2 enables it
+        static uint64_t      POSTED       = 0u; // ->> Hash of the last `post(...)`ed position
+        static LONG volatile READY        = 1;
+        static Game::Context ROOT         = Game::Context();
+        static HANDLE        SIGNAL       = NULL; // ->> Auto-reset; Raised by `post(...)`
+        static Snapshot      SNAPSHOTS[3] = {};
+        static HANDLE        THREAD       = NULL; // ->> Kept between moves
+
+        // ... ->> State of the calling thread's `search(...)`
+        static THREAD_LOCAL bool          CANCELLED  = false;
+        static THREAD_LOCAL unsigned char COMPLETED  = 0u; // ->> Depth reached so far
+        static THREAD_LOCAL LONG          JOB        = 0; // ->> `GENERATION` being searched
+        static THREAD_LOCAL bool          NETWORK    = true; // ->> Leaves are scored by `Game::Network` if it is loaded, else linearly
+        static THREAD_LOCAL unsigned long NODE_LIMIT = 0uL; // ->> Stops the search once it has a move; Zero if none
+        static THREAD_LOCAL unsigned long NODES      = 0uL;
+        static THREAD_LOCAL LONGLONG      STOP       = 0; // ->> Performance counter the search stops at once it has a move; Zero if none
+
+        static bool         isCancelled();
+        static void         post       (DWORD const);
+        static void         publish    (Snapshot const&);
+        static DWORD WINAPI run        (LPVOID const);
+        static int          search     (unsigned char const, unsigned char const, int, int const, unsigned char[]);
+    }
+
+    namespace Atlas /* ->> `--atlas [size...]`: Converts `pieces.bmp` into `pieces.atlas`; Every piece size is box-filtered, premultiplied & trimmed once, offline, so that the game maps it & blits it as-is */ {
+        static unsigned char const SIZE_LIMIT = 16u;
+
+        static int main(char const[]);
+    }
+
+    namespace Benchmark /* ->> `--bench [network] [nodes]`: Times `Game::setHover(...)` over a synthetic pointer trace, `Game::Replay::seek(...)` & a loopback fan-out of a random game's stream to subscriber threads, then `Game::Network::evaluate()` over the positions of a random game */ {
+        typedef struct Subscriber { ::HANDLE pipe; unsigned long frames; unsigned char state[sizeof(Game::Replay::STATE)]; } Subscriber; // ->> Decodes frames off its end of a pipe as a spectator would off a socket
+
+        // ...
+        static bool         choose   (uint32_t&, unsigned char[]);
+        static int          main     (char const[]);
+        static DWORD WINAPI subscribe(LPVOID const);
+    }
+
+    namespace Generator /* ->> `--generate file [games] [depth] [nodes]`: Self-play from randomised openings on every core; Quiet positions are scored by `Analysis::search(...)` & handed to one writer thread in batches through lock-free rings */ {
+        static std::size_t const   BATCH_CAPACITY = 4096u; // ->> Samples per write
+        static unsigned char const BATCH_COUNT    = 4u;    // ->> per worker; Power of two
+        static int const           DECISIVE       = 2000;  // ->> Centipawns past which a game is adjudicated
+        static char const          MAGIC[4]       = {'C', 'H', 'C', '2'}; // ->> Heads every corpus; Headerless ones predate the turn moving to state byte 17 & are refused
+        static unsigned short const PLY_LIMIT     = 256u;  // ->> Drawn past it
+        static unsigned char const RANDOM_PLIES   = 8u;    // ->> Opening moves picked at random
+        static std::size_t const   RECORD_SIZE    = 38u;   // ->> after `MAGIC`: 35-byte state, little-endian 16-bit score (centipawns for light), then 0, 1 or 2 for a dark win, draw or light win
+
+        typedef struct Batch { std::size_t count; unsigned char samples[BATCH_CAPACITY * RECORD_SIZE]; } Batch;
+        typedef struct Ring { LONG volatile read, write; Batch *batches[BATCH_COUNT]; } Ring; // ->> Single-producer, single-consumer
+
+        typedef struct Worker {
+            Batch         batches[BATCH_COUNT];
+            Batch        *batch;   // ->> Being filled
+            Ring          empty;   // ->> Writer to worker
+            Ring          full;    // ->> Worker to writer
+            uint32_t      random;  // ->> xorshift state
+            LONG volatile samples;
+        } Worker;
+
+        static unsigned char  DEPTH        = 3u;
+        static std::FILE     *FILE         = NULL;
+        static LONG volatile  GAMES        = 0; // ->> Left to start
+        static unsigned long  NODES        = 0uL; // ->> per move; Zero if only `DEPTH` bounds it
+        static LONG volatile  RUNNING      = 0; // ->> Workers yet to finish
+        static DWORD          WORKER_COUNT = 0u;
+        static Worker        *WORKERS      = NULL;
+
+        static bool         flush(Worker&);
+        static int          main (char const[]);
+        static bool         pop  (Ring&, Batch*&);
+        static bool         push (Ring&, Batch* const);
+        static DWORD WINAPI run  (LPVOID const);
+        static DWORD WINAPI write(LPVOID const);
+    }
+
+    namespace Index /* ->> `--index corpus [copies] query[; query...]`: Inverted index from (piece, tile) & material keys to roaring-style posting lists of corpus positions; A query intersects its keys' lists instead of decoding records */ {
+        typedef struct Container { // ->> Positions `chunk × 65536` onward; A sorted `uint16_t` array while `cardinality` is at most `ARRAY_LIMIT`, a 65536-bit bitmap past it
+            uint32_t capacity, cardinality;
+            uint16_t chunk;
+            void    *values;
+        } Container;
+
+        typedef struct Postings { uint32_t capacity, count; uint64_t cardinality; Container *containers; } Postings;
+        typedef struct Material { uint64_t signature; Postings postings; } Material; // ->> Four bits per `getBoard(...)` code's count
+
+        static uint32_t const      ARRAY_LIMIT = 4096u; // ->> Past which a bitmap is no larger
+        static unsigned char const KEY_LIMIT   = 33u; // ->> per query: 32 pieces & a material signature
+
+        static std::size_t MATERIAL_CAPACITY = 0u; // ->> Power of two; Open addressing on `signature`
+        static std::size_t MATERIAL_COUNT    = 0u;
+        static Material   *MATERIALS         = NULL;
+        static Postings    PIECES[12][64]    = {{{0u, 0u, 0u, NULL}}}; // ->> by `getBoard(...)` code (light pieces after dark), then tile
+
+        static bool          add      (Postings&, uint32_t const);
+        static Postings*     find     (uint64_t const, bool const);
+        static uint64_t      intersect(Postings* const[], unsigned char);
+        static int           main     (char const[]);
+        static unsigned char parse    (char const[], Postings*[]);
+        static void          release  (Postings&);
+    }
+
+    namespace Input /* ->> Lock-free single-producer (window thread), single-consumer (`Simulation::THREAD`) ring of input messages */ {
+        typedef struct Event { LONGLONG time; UINT message; WPARAM parameter; LPARAM subparameter; } Event;
+
+        static unsigned short const CAPACITY         = 256u; // ->> Power of two; Input is dropped while full
+        static Event                EVENTS[CAPACITY] = {};
+        static LONG volatile        READ             = 0; // ->> Advanced by the consumer only
+        static HANDLE               SIGNAL           = NULL; // ->> Auto-reset; Raised by every `push(...)`
+        static LONG volatile        WRITE            = 0; // ->> Advanced by the producer only
+
+        static bool pop (Event&);
+        static bool push(UINT const, WPARAM const, LPARAM const);
+    }
+
+    namespace Load /* ->> `--load [threads]`: Busy workers on every processor (or `threads` of them) plus a synthetic pointer sweep over the board, so `Profiler::LATENCY` is sampled under load; Exported on exit */ {
+        static DWORD const   SWEEP_INTERVAL = 8u; // ->> Milliseconds between synthetic `WM_MOUSEMOVE`s
+        static HANDLE        THREADS[64]    = {NULL}; // ->> Sweeper first
+        static unsigned char THREAD_COUNT   = 0u;
+
+        static DWORD WINAPI spin (LPVOID const);
+        static void         start(char const[]);
+        static void         stop ();
+        static DWORD WINAPI sweep(LPVOID const);
+    }
+
     namespace Lock {
         static HANDLE      FILE       = NULL;
         static char const *FILE_NAME  = NULL;
@@ -166,6 +535,268 @@ namespace Program {
         static char const *MUTEX_NAME = NULL;
     }
 
+    namespace Loop /* ->> Blocks until a thread message, a signal or the next fixed-timestep tick is due, then dispatches whichever woke it; Shared by the window & simulation threads */ {
+        static int run(MSG&, HANDLE const, bool (*const)(), DWORD const, void (*const)());
+    }
+
+    namespace Metrics /* ->> Hot-path counters & latency histograms in a cache line-aligned slot per thread; Summed on demand for each reader of `PIPE_NAME`, as Prometheus text */ {
+        typedef enum Counter { ACCESSES /* ->> `Piece` accessor calls */, ACCUMULATOR_HITS, ACCUMULATOR_MISSES, DESTINATION_HITS, DESTINATION_MISSES, ITERATIONS /* ->> `Game::getNextPiece(...)` calls */, NODES, POSITIONS /* ->> made by `Game::move(...)` */ } Counter;
+        typedef enum Latency { EVALUATION, GENERATION /* ->> of uncached legal destinations */ } Latency;
+
+        static unsigned char const BUCKET_COUNT    = 16u; // ->> Bucket `n` counts durations below 2ⁿ⁺⁶ nanoseconds; One more counts the rest
+        static unsigned char const COUNTER_COUNT   = POSITIONS + 1u;
+        static unsigned char const LATENCY_COUNT   = GENERATION + 1u;
+        static char const          PIPE_NAME[]     = "\\\\.\\pipe\\ChessMetrics"; // ->> Served by one process at a time; e.g.: `type \\.\pipe\ChessMetrics`
+        static unsigned char const SAMPLE_INTERVAL = 64u; // ->> One in this many evaluations is timed, & weighed as this many; A power of two below 256
+        static unsigned char const SLOT_COUNT      = 64u; // ->> Threads past it share the last slot, & may lose counts to races
+
+        typedef struct CACHE_ALIGNED Slot {
+            uint64_t counters  [COUNTER_COUNT];
+            uint64_t durations [LATENCY_COUNT]; // ->> Summed, in nanoseconds
+            uint64_t histograms[LATENCY_COUNT][BUCKET_COUNT + 1u];
+        } Slot;
+
+        static LARGE_INTEGER       FREQUENCY                          = LARGE_INTEGER();
+        static HANDLE const        INVALID_PIPE                       = INVALID_HANDLE_VALUE; // ->> Spelt out here, where `HANDLE` is not yet `Program::HANDLE`
+        static char const   *const HELP         [COUNTER_COUNT]       = {"Piece accessor calls", "Network evaluations from current accumulators", "Network accumulators refreshed from scratch", "Legal destinations served from the per-position cache", "Legal destinations generated", "Game::getNextPiece(...) calls", "Analysis::search(...) nodes", "Positions made by Game::move(...)"};
+        static char const   *const LATENCY_HELP [LATENCY_COUNT]       = {"Duration of a position evaluation, sampled", "Duration of generating a piece's legal destinations"};
+        static char const   *const LATENCY_NAMES[LATENCY_COUNT]       = {"chess_evaluation_seconds", "chess_move_generation_seconds"};
+        static char const   *const NAMES        [COUNTER_COUNT]       = {"chess_piece_accesses_total", "chess_accumulator_hits_total", "chess_accumulator_misses_total", "chess_destination_hits_total", "chess_destination_misses_total", "chess_piece_iterations_total", "chess_search_nodes_total", "chess_positions_total"};
+        static bool volatile       SERVING                            = false;
+        static Slot                SLOTS[SLOT_COUNT]                  = {};
+        static LONG volatile       SLOTS_USED                         = 0;
+        static HANDLE              THREAD                             = NULL;
+
+        static THREAD_LOCAL uint32_t      PENDING[COUNTER_COUNT] = {0u};  // ->> Plain increments of the calling thread, added to its slot by `flush()` once per search node or generated destination set
+        static THREAD_LOCAL unsigned char SAMPLES                = 0u;    // ->> Evaluations by the calling thread, modulo 256
+        static THREAD_LOCAL Slot         *SLOT                   = NULL;  // ->> of the calling thread; Acquired on first use
+
+        static Slot&        acquire();
+        static void         count  (Counter const);
+        static void         flush  ();
+        static std::size_t  format (char[]);
+        static void         observe(Latency const, LONGLONG const, unsigned char const = 1u);
+        static DWORD WINAPI run    (LPVOID const);
+        static bool         sample ();
+        static bool         start  ();
+        static void         stop   ();
+    }
+
+    namespace Profiler /* ->> Toggled with F3; Exported as Chrome trace JSON with F5 */ {
+        typedef enum Phase { ANTICIPATE, BOARD, PIECES, PRESENT, LATENCY /* ->> input queued to frame presented */ } Phase;
+        typedef struct Sample { LONGLONG duration, start; unsigned char phase; } Sample;
+
+        static unsigned char const  BUCKET_COUNT   = 24u; // ->> Bucket `n` counts durations below 2ⁿ microseconds
+        static unsigned char const  PHASE_COUNT    = LATENCY + 1u;
+        static unsigned short const TRACE_CAPACITY = 1024u;
+
+        static bool          ENABLED                              = false;
+        static char const   *FILE_NAME                            = NULL;
+        static LARGE_INTEGER FREQUENCY                            = LARGE_INTEGER();
+        static LONG volatile HISTOGRAM[PHASE_COUNT][BUCKET_COUNT] = {{0}};
+        static char const   *NAMES    [PHASE_COUNT]               = {"anticipate", "board", "pieces", "present", "latency"};
+        static Sample        TRACE    [TRACE_CAPACITY]            = {};
+        static LONG volatile TRACE_COUNT                          = 0;
+
+        // ...
+        static void draw  (HDC const);
+        static void record(unsigned char const, LONGLONG const, LONGLONG const);
+        static bool save  ();
+    }
+
+    namespace Render /* ->> Triple-buffered frames: `BACK` is rendered on `THREAD` while the window thread presents `FRONT`; `READY` swaps between them */ {
+        typedef struct Frame { // ->> What `RENDER()` reads; Copied from the game under `Simulation::STATE`, then drawn without it
+            Game::Context context; // ->> `memory` & `hash` only; `THREAD`'s `Game::CONTEXT`
+            unsigned char hover, select;
+            bool          hovered, selected;
+        } Frame;
+
+        static LONG const    FRESH         = 0x4; // ->> Set on `READY` until the window thread takes it
+        static unsigned char BACK          = 0u;
+        static Frame         FRAME         = Frame();
+        static unsigned char FRONT         = 2u;
+        static LONGLONG      INPUT_TIME[3] = {0}; // ->> Earliest input reflected by each frame; Zero if none
+        static LONGLONG      PENDING_TIME  = 0; // ->> Earliest input not yet rendered; Guarded by `Simulation::STATE`
+        static LONG volatile READY         = 1;
+        static HANDLE        SIGNAL        = NULL; // ->> Auto-reset; Raised by `UPDATE()` to request a frame
+        static HANDLE        THREAD        = NULL;
+
+        static DWORD WINAPI run(LPVOID const);
+    }
+
+    namespace Server /* ->> `--serve [games] [port] [workers]`: Hosts up to `games` games at once in the `Game::Contexts` arena for clients on loopback TCP; Their moves are played & answered by engine workers, each with its own queue & stealing from the others' once it runs dry */ {
+        typedef enum Kind   { CLOSE, MOVE, OPEN } Kind;
+        typedef enum Status { OK, BUSY /* ->> A request for the game is in flight */, FULL /* ->> No context left in the arena */, ILLEGAL, OVER /* ->> Played; The engine has no move to answer with */, UNKNOWN /* ->> No such game open */ } Status;
+
+        // ... ->> Every request & reply is one 12-byte message, little-endian as laid out on x86; A reply echoes its request but for `code` (& after a `MOVE`, `from` & `to`)
+        typedef struct Message {
+            unsigned char kind;
+            unsigned char from, to; // ->> The client's move; The engine's answer, in a reply
+            unsigned char code;     // ->> Depth the engine searches its answer to a `MOVE` to; `Status`, in a reply
+            uint32_t      game;     // ->> Index of its context in the arena; Assigned by `OPEN`
+            uint32_t      tag;      // ->> The client's own, echoed
+        } Message;
+
+        typedef struct Connection {
+            LONG volatile lock;    // ->> Spin lock over sends; Shared with the workers answering on it
+            DWORD         next;    // ->> Worker its next move is queued on, round-robin
+            LONG volatile pending; // ->> Moves queued or being played; Drained before `socket` is closed
+            SOCKET        socket;
+            HANDLE        thread;
+            LONG volatile used;
+        } Connection;
+
+        typedef struct Task { Connection *connection; Message message; } Task;
+
+        // ... ->> The owner takes its oldest task, so a worker's moves are answered in order; Idle workers steal the newest
+        typedef struct CACHE_ALIGNED Worker {
+            std::size_t volatile head, tail; // ->> Free-running; Masked by `QUEUE_CAPACITY - 1u`
+            LONG volatile        lock;
+            Task                *tasks;
+            HANDLE               thread;
+        } Worker;
+
+        static unsigned char const CONNECTION_LIMIT = 64u;
+        static unsigned char const DEPTH_LIMIT      = 4u; // ->> of an answer
+        static unsigned char const WORKER_LIMIT     = 64u;
+
+        static Connection     CONNECTIONS[CONNECTION_LIMIT] = {};
+        static HANDLE         PENDING                       = NULL; // ->> Semaphore counting the tasks queued across every worker
+        static unsigned short PORT                          = 7480u;
+        static std::size_t    QUEUE_CAPACITY                = 0u; // ->> Tasks per worker; A power of two no less than the arena, as each game has at most one in flight
+        static LONG volatile *STATES                        = NULL; // ->> per arena context: 0 if closed, 1 if open, 2 while a move is in flight
+        static DWORD          WORKER_COUNT                  = 0u;
+        static Worker         WORKERS[WORKER_LIMIT]         = {};
+
+        static void         answer (Task const&);
+        static int          main   (char const[]);
+        static bool         pop    (Worker&, Task&, bool const);
+        static void         push   (Worker&, Task const&);
+        static DWORD WINAPI receive(LPVOID const);
+        static void         reply  (Connection&, void const*, std::size_t const);
+        static DWORD WINAPI run    (LPVOID const);
+        static bool         write  (SOCKET const, void const*, std::size_t const);
+    }
+
+    namespace Simulation /* ->> Owns the game state; Applies queued input & `UPDATE()` off the window thread */ {
+        static bool volatile    RUNNING = false;
+        static CRITICAL_SECTION STATE   = CRITICAL_SECTION(); // ->> Held while the state is changed or copied for `Render::FRAME`
+        static HANDLE           THREAD  = NULL;
+
+        static void         dispatch(Input::Event const&);
+        static DWORD WINAPI run     (LPVOID const);
+        static bool         step    ();
+        static void         tick    ();
+    }
+
+    namespace State /* ->> Named shared-memory ring of position snapshots, each behind a seqlock; Published by `Simulation::THREAD` whenever the position changes, read in place by `--watch [seconds]` & other local tools */ {
+        typedef struct CACHE_ALIGNED Header {
+            char          magic[4];
+            DWORD         capacity; // ->> Entries after the header
+            DWORD         size;     // ->> of an `Entry`, header included
+            LONG volatile version;  // ->> Latest published; Held by entry `version % capacity`
+        } Header;
+
+        typedef struct CACHE_ALIGNED Entry {
+            LONG volatile sequence;   // ->> Twice the version held; Odd while being overwritten
+            LONGLONG      counter;    // ->> `QueryPerformanceCounter(...)` when published
+            unsigned char memory[35]; // ->> `Game::Context::memory`
+        } Entry;
+
+        static DWORD const  CAPACITY       = 256u; // ->> Versions a reader may fall behind before missing some
+        static char const   MAGIC[4]       = {'C', 'H', 'S', '1'};
+        static char const   MAPPING_NAME[] = "ChessStateRing";
+        static HANDLE const PAGING_FILE    = INVALID_HANDLE_VALUE; // ->> Backs `MAPPING`; Spelt out here, where `HANDLE` is not yet `Program::HANDLE`
+
+        static Entry    *ENTRIES = NULL;
+        static uint64_t  HASH    = 0u;   // ->> of the last published position
+        static Header   *HEADER  = NULL; // ->> Start of the mapped view
+        static HANDLE    MAPPING = NULL;
+
+        static bool open   ();
+        static void publish();
+        static bool read   (Entry const&, LONG const, unsigned char[], LONGLONG&);
+        static int  watch  (char const[]);
+    }
+
+    namespace Swarm /* ->> `--swarm [games] [connections] [plies] [depth] [port]`: Load generator for `--serve`; Keeps `games` games in flight over a few connections, each a random mover against the engine, & reports percentiles of the time from sending a move to receiving its answer */ {
+        typedef struct Table {
+            Game::Context *context; // ->> Mirrors the server's
+            uint32_t       game;
+            unsigned short plies;   // ->> Answered so far
+            uint32_t       random;  // ->> xorshift state
+            LONGLONG       sent;    // ->> Performance counter its move was sent at
+        } Table;
+
+        static DWORD          CONNECTION_COUNT = 8u;
+        static unsigned char  DEPTH            = 1u;
+        static LONG volatile  FAILURES         = 0; // ->> Games refused or cut short by a status other than `Server::OVER`
+        static LARGE_INTEGER  FREQUENCY        = LARGE_INTEGER();
+        static uint32_t      *LATENCIES        = NULL; // ->> in microseconds; `PLIES` per table
+        static unsigned short PLIES            = 16u;  // ->> Moves per game, unless it ends sooner
+        static std::size_t    TABLE_COUNT      = 0u;
+        static Table         *TABLES           = NULL;
+
+        static int          compare(void const*, void const*);
+        static int          main   (char const[]);
+        static bool         pick   (Table&, Server::Message&);
+        static DWORD WINAPI run    (LPVOID const);
+    }
+
+    namespace Tournament /* ->> `--tournament openings [games] [milliseconds] [increment] [first] [second]`: Games between two evaluators (`network` or `linear`), one per core, each opening played once from either side; Stopped as soon as a sequential probability ratio test decides, with progress streamed as JSON lines */ {
+        static unsigned char const  OPENING_LIMIT = 32u; // ->> Moves per opening
+
+        typedef struct Opening { unsigned char count; unsigned char moves[OPENING_LIMIT][2]; } Opening;
+
+        static double const         ALPHA         = 0.05; // ->> False positive rate of the test
+        static double const         BETA          = 0.05; // ->> False negative rate of the test
+        static unsigned char const  DEPTH_LIMIT   = 64u;
+        static int const            DRAWN         = 10;   // ->> Centipawns within which a long game is adjudicated drawn...
+        static unsigned char const  DRAWN_PLIES   = 8u;   // ->> ...for this many plies in a row...
+        static unsigned short const DRAWN_PLY     = 80u;  // ->> ...past this ply
+        static double const         ELO0          = 0.0;  // ->> Null hypothesis: The first engine is no stronger than this
+        static double const         ELO1          = 5.0;  // ->> Alternative hypothesis: The first engine is this much stronger
+        static unsigned short const PLY_LIMIT     = 400u; // ->> Drawn past it
+        static int const            WON           = 1000; // ->> Centipawns past which a game is adjudicated won...
+        static unsigned char const  WON_PLIES     = 4u;   // ->> ...for this many plies in a row
+
+        static bool          ENGINES[2]    = {true, false}; // ->> Whether the first & second engine score by `Game::Network`
+        static LONG volatile FORFEITS      = 0;  // ->> Games lost on time
+        static LONG          GAMES         = 0;
+        static DWORD         INCREMENT     = 100u;   // ->> Milliseconds added per move
+        static LONG volatile NEXT          = 0;  // ->> Game to start next; Pairs share an opening
+        static std::size_t   OPENING_COUNT = 0u;
+        static Opening      *OPENINGS      = NULL;
+        static LONG volatile RESULTS[3]    = {0, 0, 0}; // ->> Losses, draws & wins of the first engine
+        static LONG volatile RUNNING       = 0;  // ->> Workers yet to finish
+        static HANDLE        SIGNAL        = NULL; // ->> Auto-reset; Raised per finished game
+        static bool volatile STOPPED       = false;  // ->> Decided; Games in progress are abandoned
+        static DWORD         TIME          = 10000u; // ->> Milliseconds per player per game
+
+        static int           main(char const[]);
+        static unsigned char play(Opening const&, bool const);
+        static DWORD WINAPI  run (LPVOID const);
+    }
+
+    namespace Tuner /* ->> `--tune corpus [epochs] [rate]`: Fits `Game::Evaluation::WEIGHTS` to labelled positions by full-batch Adam on a logistic loss; Workers keep their own gradient, reduced once they all finish */ {
+        typedef struct Work {
+            bool        decoding; // ->> Otherwise accumulating `gradient` & `loss`
+            std::size_t first, last;
+            double      gradient[Game::Evaluation::FEATURE_COUNT];
+            double      loss;
+        } Work;
+
+        static std::size_t const RECORD_SIZE = Generator::RECORD_SIZE; // ->> The records `--generate` writes; Only the state & the result are fitted to
+        static double const      SCALE       = 0.00575646273; // ->> ln(10) ÷ 400, i.e.: 400 centipawns is 10:1 odds
+
+        static unsigned char *BOARDS = NULL; // ->> 32 bytes per position, two `getBoard(...)` tiles per byte
+        static unsigned char *CORPUS = NULL;
+
+        static unsigned char* load(char const[], std::size_t&);
+        static int            main(char const[]);
+        static DWORD WINAPI   run (LPVOID const);
+    }
+
     // ...
     static LPSTR     ARGUMENTS           = NULL;
     static int       EXIT_CODE           = EXIT_SUCCESS;
@@ -173,6 +804,7 @@ namespace Program {
     static HINSTANCE HANDLE              = NULL;
     static HINSTANCE PREVIOUS_HANDLE     = NULL;
     static MSG       THREAD_MESSAGE      = MSG();
+    static DWORD     TICK                = 0u; // ->> Fixed timestep (in milliseconds) of `Program::ontick`; Unused when zero
 
     // ... ->> Termination handlers
     static void exit ();
@@ -187,6 +819,9 @@ namespace Program {
     static void (*onmathfault   )() = NULL;
     static void (*onsegfault    )() = NULL;
     static void (*onterminate   )() = NULL;
+
+    // ... ->> Update listeners
+    static void (*ontick        )() = NULL;
 }
 
 // : Window
@@ -201,6 +836,8 @@ namespace Window {
     static int     HEIGHT          = -1;
     static HICON   ICON            = NULL;
     static int     LEFT            = -1;
+    static POINTS  POINTER         = POINTS(); // ->> Latest pointer position; Applied once `Program::Input` is drained
+    static bool    POINTER_MOVED   = false;
     static LRESULT CALLBACK (*PROCEDURE)(HWND const, UINT const, WPARAM const, LPARAM const) = &::DefWindowProc;
     static DWORD   STYLE           = WS_OVERLAPPEDWINDOW;
     static DWORD   STYLE_EXTENSION = 0x00000000L;
@@ -212,10 +849,11 @@ namespace Window {
     static HBITMAP DEVICE_CONTEXT_BITMAP_HANDLE        = NULL;
     static HDC     DEVICE_CONTEXT_HANDLE               = NULL;
 
-    static BITMAP  MEMORY_DEVICE_CONTEXT_BITMAP        = ::BITMAP();
-    static HBITMAP MEMORY_DEVICE_CONTEXT_BITMAP_HANDLE = NULL;
-    static UINT32 *MEMORY_DEVICE_CONTEXT_BITMAP_MEMORY = NULL;
-    static HDC     MEMORY_DEVICE_CONTEXT_HANDLE        = NULL;
+    static Framebuffer FRAMEBUFFER                        [3] = {}; // ->> over `MEMORY_DEVICE_CONTEXT_BITMAP_MEMORY`; One per `Program::Render` frame
+    static BITMAP      MEMORY_DEVICE_CONTEXT_BITMAP       [3] = {};
+    static HBITMAP     MEMORY_DEVICE_CONTEXT_BITMAP_HANDLE[3] = {NULL};
+    static UINT32     *MEMORY_DEVICE_CONTEXT_BITMAP_MEMORY[3] = {NULL};
+    static HDC         MEMORY_DEVICE_CONTEXT_HANDLE       [3] = {NULL};
 }
 
 /* Global > ... */
@@ -228,25 +866,409 @@ Piece::Movement const Piece::Movement::JUMP     = 0x08u;
 Piece::Movement const Piece::Movement::SALTIRE  = 0x10u;
 
 /* Function */
+// : Framebuffer
+Framebuffer::Framebuffer() : clip(), height(0), memory(NULL), stride(0L), width(0) {}
+Framebuffer::Framebuffer(UINT32 memory[], long const stride, int const width, int const height) : clip(), height(height), memory(memory), stride(stride), width(width) {
+    this -> setClip(0, 0, width, height);
+}
+
+Framebuffer::Framebuffer(VOID* const bits, BITMAPINFOHEADER const& header) : clip(), height(header.biHeight < 0L ? -header.biHeight : header.biHeight), memory(static_cast<UINT32*>(bits)), stride(header.biHeight < 0L ? +header.biWidth : -header.biWidth), width(header.biWidth) {
+    if (header.biHeight > 0L) this -> memory += (this -> height - 1L) * header.biWidth; // ->> Bottom-up
+    this -> setClip(0, 0, this -> width, this -> height);
+}
+
+// ... ->> Copies a `width × height` image (rows `sourceStride` pixels apart) to `left`, `top`; `masked` skips pixels without alpha
+void Framebuffer::blit(int const left, int const top, UINT32 const source[], long const sourceStride, int const width, int const height, bool const masked) {
+    int const bottom = top + height < this -> clip.bottom ? top + height : this -> clip.bottom;
+
+    for (int y = top > this -> clip.top ? top : this -> clip.top; y < bottom; ++y)
+    this -> write(y, left, source + ((y - top) * sourceStride), width, masked);
+}
+
+// ... ->> Fills pixels `[left, right)` of row `y`
+void Framebuffer::fill(int const y, int left, int right, UINT32 const pixel) {
+    if (y >= this -> clip.top && y < this -> clip.bottom) {
+        UINT32 *const row = this -> getRow(y);
+
+        if (left  < this -> clip.left ) left  = this -> clip.left;
+        if (right > this -> clip.right) right = this -> clip.right;
+        while (left < right) row[left++] = pixel;
+    }
+}
+
+UINT32* Framebuffer::getRow(int const y) const { return this -> memory + (y * this -> stride); }
+
+// ... ->> Narrowed to the framebuffer bounds
+void Framebuffer::setClip(int const left, int const top, int const right, int const bottom) {
+    this -> clip.bottom = bottom < this -> height ? bottom : this -> height;
+    this -> clip.left   = left   > 0              ? left   : 0;
+    this -> clip.right  = right  < this -> width  ? right  : this -> width;
+    this -> clip.top    = top    > 0              ? top    : 0;
+}
+
+// ... ->> Copies `count` pixels to row `y` from `left`; Masked pixels are premultiplied & drawn over the row
+void Framebuffer::write(int const y, int left, UINT32 const source[], int const count, bool const masked) {
+    if (y >= this -> clip.top && y < this -> clip.bottom) {
+        int const     right = left + count < this -> clip.right ? left + count : this -> clip.right;
+        UINT32 *const row   = this -> getRow(y);
+
+        if (left < this -> clip.left) { source += this -> clip.left - left; left = this -> clip.left; }
+        if (left < right) {
+            if (false == masked) std::memcpy(row + left, source, (right - left) * sizeof(UINT32));
+            else for (; left < right; ++left, ++source) {
+                UINT32 const alpha = *source >> 24u;
+
+                if (0xFFu == alpha) row[left] = *source;
+                else if (0x00u != alpha) row[left] = *source + ((((row[left] & 0xFF00FFu) * (0xFFu - alpha)) >> 8u) & 0xFF00FFu) + ((((row[left] & 0x00FF00u) * (0xFFu - alpha)) >> 8u) & 0x00FF00u);
+            }
+        }
+    }
+}
+
 // : Game
-bit<8u>* Game::addressCapturedOfficerData() { return Game::MEMORY + 16; }
-bit<8u>* Game::addressCapturedPawnData   () { return Game::MEMORY + 33; }
-bit<8u>* Game::addressCastleData         () { return Game::MEMORY + 32; }
-bit<8u>* Game::addressIncidentalPawnData () { return Game::MEMORY + 32; }
-bit<8u>* Game::addressPromotedPawnData   () { return Game::MEMORY + 18; }
-bit<8u>* Game::addressTurnData           () { return Game::MEMORY + 34; }
+Game::Context* Game::acquireContext() {
+    Game::Context *context = NULL;
+
+    while (0 != ::InterlockedExchange(&Game::Contexts::LOCK, 1)) ::Sleep(0u);
+      if (NULL != Game::Contexts::FREE) { context = Game::Contexts::FREE; Game::Contexts::FREE = context -> next; }
+      else if (Game::Contexts::COUNT != Game::Contexts::CAPACITY) context = Game::Contexts::MEMORY + Game::Contexts::COUNT++;
+    ::InterlockedExchange(&Game::Contexts::LOCK, 0);
+
+    if (NULL != context) {
+        for (bit<8u> *data = context -> memory + (sizeof(context -> memory) / sizeof(bit<8u>)); data-- != context -> memory; ) *data = 0x00u;
+        context -> clock[0] = context -> clock[1] = 0u;
+        context -> accumulated = 0x00u;
+        context -> hash        = 0u;
+        context -> next        = NULL;
+    }
+
+    return context;
+}
+
+void Game::releaseContext(Game::Context* const context) {
+    while (0 != ::InterlockedExchange(&Game::Contexts::LOCK, 1)) ::Sleep(0u);
+      context -> next      = Game::Contexts::FREE;
+      Game::Contexts::FREE = context;
+    ::InterlockedExchange(&Game::Contexts::LOCK, 0);
+}
+
+// ... ->> FNV-1a over the current context
+uint64_t Game::rehash() {
+    uint64_t hash = 0xCBF29CE484222325uLL;
+
+    for (std::size_t index = 0u; index != sizeof(Game::CONTEXT -> memory) / sizeof(bit<8u>); ++index)
+    hash = (hash ^ static_cast<unsigned char>(Game::CONTEXT -> memory[index])) * 0x00000100000001B3uLL;
+
+    return Game::CONTEXT -> hash = hash;
+}
+
+// ... ->> Committed up front so contexts never move; Only called before any are acquired
+bool Game::reserveContexts(std::size_t const capacity) {
+    if (NULL != Game::Contexts::MEMORY) return capacity <= Game::Contexts::CAPACITY;
+
+    Game::Contexts::MEMORY   = static_cast<Game::Context*>(::VirtualAlloc(NULL, capacity * sizeof(Game::Context), MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE));
+    Game::Contexts::CAPACITY = NULL != Game::Contexts::MEMORY ? capacity : 0u;
+
+    return NULL != Game::Contexts::MEMORY;
+}
+
+bit<8u>* Game::addressCapturedOfficerData() { return Game::CONTEXT -> memory + 16; }
+bit<8u>* Game::addressCapturedPawnData   () { return Game::CONTEXT -> memory + 33; }
+bit<8u>* Game::addressCastleData         () { return Game::CONTEXT -> memory + 32; }
+bit<8u>* Game::addressIncidentalPawnData () { return Game::CONTEXT -> memory + 32; }
+bit<8u>* Game::addressPromotedPawnData   () { return Game::CONTEXT -> memory + 18; }
+bit<8u>* Game::addressTurnData           () { return Game::CONTEXT -> memory + 17; } // ->> Low bit; Clear of the captured queen & rook bits
 bit<8u>* Game::addressPieceData(Piece::Type const type) {
     switch (type) {
-        case Piece::BISHOP: return Game::MEMORY + 20;
-        case Piece::KING  : return Game::MEMORY - 2;
-        case Piece::KNIGHT: return Game::MEMORY + 24;
-        case Piece::PAWN  : return Game::MEMORY + 0;
-        case Piece::QUEEN : return Game::MEMORY - 4;
-        case Piece::ROOK  : return Game::MEMORY + 28;
+        case Piece::BISHOP: return Game::CONTEXT -> memory + 20;
+        case Piece::KING  : return Game::CONTEXT -> memory - 2;
+        case Piece::KNIGHT: return Game::CONTEXT -> memory + 24;
+        case Piece::PAWN  : return Game::CONTEXT -> memory + 0;
+        case Piece::QUEEN : return Game::CONTEXT -> memory - 4;
+        case Piece::ROOK  : return Game::CONTEXT -> memory + 28;
     } return NULL;
 }
 
+void Game::drawBoardLayer() {
+    unsigned short const tileHeight        = Game::getTileHeight();
+    unsigned short const tileWidth         = Game::getTileWidth();
+    unsigned short const height            = (tileHeight + Game::Tiles::MARGIN) * Game::Tiles::ROW_COUNT;
+    unsigned short const width             = (tileWidth  + Game::Tiles::MARGIN) * Game::Tiles::COLUMN_COUNT;
+    unsigned short const tileContentHeight = tileHeight - Game::Tiles::MARGIN;
+    unsigned short const tileContentWidth  = tileWidth  - Game::Tiles::MARGIN;
+
+    std::free(Game::Board::LAYER);
+    Game::Board::LAYER         = static_cast<UINT32*>(std::malloc(height * width * sizeof(UINT32)));
+    Game::Board::LAYER_INVALID = false;
+
+    if (NULL != Game::Board::LAYER) {
+        Framebuffer layer = Framebuffer(Game::Board::LAYER, width, width, height);
+
+        for (unsigned short boardY = height; boardY--; )
+        layer.fill(boardY, 0, width, 0xFF000000u | Game::Board::COLOR);
+
+        // ... ->> Tiles
+        for (unsigned char tile = Game::Tiles::COLUMN_COUNT * Game::Tiles::ROW_COUNT; tile--; ) {
+            int const    left      = ((tile % Game::Tiles::COLUMN_COUNT) * (tileWidth  + Game::Tiles::MARGIN)) + Game::Tiles::MARGIN;
+            int const    top       = ((tile / Game::Tiles::COLUMN_COUNT) * (tileHeight + Game::Tiles::MARGIN)) + Game::Tiles::MARGIN;
+            DWORD const  tileColor = ((tile % Game::Tiles::COLUMN_COUNT) + (tile / Game::Tiles::COLUMN_COUNT)) % 2u ? Game::Tiles::LIGHT_COLOR : Game::Tiles::DARK_COLOR;
+
+            for (unsigned short tileContentY = tileContentHeight; tileContentY--; )
+            layer.fill(top + tileContentY, left, left + tileContentWidth, 0xFF000000u | tileColor);
+
+            // ... ->> Bevel
+            Game::drawBevel(layer, left, top, tileContentWidth, tileContentHeight, 0xFF000000u | (
+                (((((tileColor >> 0x10u) & 0xFFu) * 2u) / 3u) << 0x10u) |
+                (((((tileColor >> 0x08u) & 0xFFu) * 2u) / 3u) << 0x08u) |
+                (((((tileColor >> 0x00u) & 0xFFu) * 2u) / 3u) << 0x00u)
+            ));
+        }
+    }
+}
+
+// ... ->> An atlas size matching the pieces is drawn from in-place; Otherwise the nearest larger size (or the bitmap) is scaled into `LAYER`
+void Game::drawPieceLayer() {
+    Game::Pieces::AtlasSize const *source = NULL;
+    unsigned short const           height = (Game::getTileHeight() * 2u) / 3u;
+    unsigned short const           width  = (Game::getTileWidth()  * 2u) / 3u;
+
+    std::free(Game::Pieces::LAYER);
+    Game::Pieces::LAYER          = NULL;
+    Game::Pieces::LAYER_INVALID  = false;
+    Game::Pieces::SPRITES        = NULL;
+    Game::Pieces::SPRITES_MEMORY = NULL;
+
+    if (NULL != Game::Pieces::ATLAS_FILE_VIEW) {
+        BYTE const *const                    file  = static_cast<BYTE const*>(Game::Pieces::ATLAS_FILE_VIEW);
+        Game::Pieces::AtlasSize const *const sizes = reinterpret_cast<Game::Pieces::AtlasSize const*>(file + sizeof(Game::Pieces::ATLAS_MAGIC) + sizeof(uint32_t));
+
+        for (uint32_t index = *reinterpret_cast<uint32_t const*>(file + sizeof(Game::Pieces::ATLAS_MAGIC)); index--; ) {
+            if (height == sizes[index].height && width == sizes[index].width) {
+                Game::Pieces::SPRITES        = reinterpret_cast<Game::Pieces::AtlasSprite const*>(file + sizes[index].offset);
+                Game::Pieces::SPRITES_MEMORY = file;
+
+                return;
+            }
+
+            if (NULL == source || (source -> height < height ? sizes[index].height > source -> height : sizes[index].height >= height && sizes[index].height < source -> height))
+            source = sizes + index;
+        }
+    }
+
+    if (NULL != source || NULL != Game::Pieces::BITMAP_MEMORY) {
+        Game::Pieces::LAYER = static_cast<UINT32*>(std::malloc(12u * height * width * sizeof(UINT32)));
+        if (NULL == Game::Pieces::LAYER) return;
+
+        for (unsigned char sprite = 12u; sprite--; ) {
+            Game::Pieces::LAYER_SPRITES[sprite].height = height;
+            Game::Pieces::LAYER_SPRITES[sprite].left   = 0u;
+            Game::Pieces::LAYER_SPRITES[sprite].offset = sprite * height * width * sizeof(UINT32);
+            Game::Pieces::LAYER_SPRITES[sprite].top    = 0u;
+            Game::Pieces::LAYER_SPRITES[sprite].width  = width;
+        }
+
+        Game::Pieces::SPRITES        = Game::Pieces::LAYER_SPRITES;
+        Game::Pieces::SPRITES_MEMORY = reinterpret_cast<BYTE const*>(Game::Pieces::LAYER);
+    }
+
+    if (NULL != source) {
+        BYTE const *const                      file    = static_cast<BYTE const*>(Game::Pieces::ATLAS_FILE_VIEW);
+        Game::Pieces::AtlasSprite const *const sprites = reinterpret_cast<Game::Pieces::AtlasSprite const*>(file + source -> offset);
+
+        for (unsigned char sprite = 12u; sprite--; )
+        for (unsigned short y = height; y--; )
+        for (unsigned short x = width ; x--; ) {
+            Game::Pieces::AtlasSprite const &box     = sprites[sprite];
+            unsigned short const             boxX    = (x * source -> width ) / width;
+            unsigned short const             boxY    = (y * source -> height) / height;
+            bool const                       covered = boxX >= box.left && boxX - box.left < box.width && boxY >= box.top && boxY - box.top < box.height;
+
+            Game::Pieces::LAYER[x + (y * width) + (sprite * height * width)] = covered ? reinterpret_cast<UINT32 const*>(file + box.offset)[(boxX - box.left) + ((boxY - box.top) * box.width)] : 0x00000000u;
+        }
+    }
+
+    else if (NULL != Game::Pieces::BITMAP_MEMORY) {
+        unsigned short const bitmapHeight    = Game::Pieces::BITMAP.bmHeight / 2u;
+        unsigned short const bitmapWidth     = Game::Pieces::BITMAP.bmWidth  / 6u;
+        DWORD const          bitmapMaskColor = Game::getPieceBitmapColor(0u, 0u);
+
+        // ... ->> One sprite per `Piece::Type` (columns of the bitmap) for each `Player` (rows of the bitmap)
+        for (unsigned char sprite = 12u; sprite--; )
+        for (unsigned short y = height; y--; )
+        for (unsigned short x = width ; x--; ) {
+            DWORD const color = Game::getPieceBitmapColor(
+                ((sprite % 6u) * bitmapWidth ) + ((x * bitmapWidth ) / width ),
+                ((sprite / 6u) * bitmapHeight) + ((y * bitmapHeight) / height)
+            );
+
+            Game::Pieces::LAYER[x + (y * width) + (sprite * height * width)] = bitmapMaskColor != color ? 0xFF000000u | color : 0x00000000u;
+        }
+    }
+}
+
+// ... ->> `BEVEL`-wide frame just inside a `width × height` rectangle; One span along the top/ bottom bevels, two (left/ right) otherwise
+void Game::drawBevel(Framebuffer& framebuffer, int const left, int const top, int const width, int const height, UINT32 const pixel) {
+    for (int y = 0; y != height; ++y) {
+        if (y < Game::Tiles::BEVEL || y > height - Game::Tiles::BEVEL) framebuffer.fill(top + y, left, left + width, pixel);
+        else {
+            framebuffer.fill(top + y, left, left + (Game::Tiles::BEVEL < width ? Game::Tiles::BEVEL : width), pixel);
+            framebuffer.fill(top + y, left + (width - Game::Tiles::BEVEL + 1 > Game::Tiles::BEVEL ? width - Game::Tiles::BEVEL + 1 : Game::Tiles::BEVEL), left + width, pixel);
+        }
+    }
+}
+
+void Game::drawTileBevel(unsigned char const tile, DWORD const color) {
+    int const left = Game::Board::LEFT + ((tile % Game::Tiles::COLUMN_COUNT) * (Game::getTileWidth()  + Game::Tiles::MARGIN)) + Game::Tiles::MARGIN;
+    int const top  = Game::Board::TOP  + ((tile / Game::Tiles::COLUMN_COUNT) * (Game::getTileHeight() + Game::Tiles::MARGIN)) + Game::Tiles::MARGIN;
+
+    Game::drawBevel(Window::FRAMEBUFFER[Program::Render::BACK], left, top, Game::getTileWidth() - Game::Tiles::MARGIN, Game::getTileHeight() - Game::Tiles::MARGIN, 0xFF000000u | color);
+}
+
+// ... ->> of a `getBoard(...)`
+float Game::evaluate(unsigned char const board[]) {
+    unsigned short indices[Game::Evaluation::FEATURE_LIMIT];
+    float          score = 0.0f;
+    LARGE_INTEGER  start;
+    bool const     timed = Program::Metrics::sample();
+    signed char    values [Game::Evaluation::FEATURE_LIMIT];
+
+    if (timed) ::QueryPerformanceCounter(&start);
+    for (unsigned char index = Game::getFeatures(board, indices, values); index--; )
+    score += Game::Evaluation::WEIGHTS[indices[index]] * values[index];
+
+    if (timed) Program::Metrics::observe(Program::Metrics::EVALUATION, start.QuadPart, Program::Metrics::SAMPLE_INTERVAL);
+    return score;
+}
+
+// ... ->> One byte per tile: `Piece::Type + 1`, with `0x80` set for light pieces; Zero if empty
+void Game::getBoard(unsigned char board[]) {
+    for (unsigned char tile = Game::Tiles::COLUMN_COUNT * Game::Tiles::ROW_COUNT; tile--; ) board[tile] = 0x00u;
+    for (Piece piece = Game::getFirstPiece(); NULL != piece.data; piece = Game::getNextPiece(piece))
+    if (false == piece.isCaptured()) board[piece.getColumn() + (piece.getRow() * Game::Tiles::COLUMN_COUNT)] = (piece.getType() + 1u) | (Player::LIGHT == piece.getPlayer() ? 0x80u : 0x00u);
+}
+
+// ... ->> Legal destinations of the piece on `tile`, as a bit per tile; Only recomputed once the position hash changes
+uint64_t Game::getDestinations(unsigned char const tile) {
+    unsigned char board[64];
+    uint64_t      destinations;
+    LARGE_INTEGER start;
+
+    if (Game::Destinations::HASH != Game::CONTEXT -> hash) {
+        Game::Destinations::COMPUTED = 0u;
+        Game::Destinations::HASH     = Game::CONTEXT -> hash;
+    }
+
+    if ((Game::Destinations::COMPUTED >> tile) & 0x01u) { Program::Metrics::count(Program::Metrics::DESTINATION_HITS); return Game::Destinations::MASKS[tile]; }
+    Program::Metrics::count(Program::Metrics::DESTINATION_MISSES);
+    ::QueryPerformanceCounter(&start);
+
+    Game::getBoard(board);
+    destinations = Game::getMoves(board, tile);
+
+    // ... ->> Drop moves that leave the mover's own king attacked
+    for (unsigned char destination = 64u; destination--; )
+    if ((destinations >> destination) & 0x01u) {
+        unsigned char king  = 64u;
+        unsigned char moved[64];
+
+        std::memcpy(moved, board, sizeof(board));
+        moved[destination] = moved[tile];
+        moved[tile]        = 0x00u;
+
+        for (unsigned char square = 64u; square--; ) if (moved[square] == ((Piece::KING + 1u) | (board[tile] & 0x80u))) king = square;
+        if (64u != king && Game::isAttacked(moved, king, 0x00u == (board[tile] & 0x80u))) destinations &= ~(static_cast<uint64_t>(1u) << destination);
+    }
+
+    Game::Destinations::COMPUTED      |= static_cast<uint64_t>(1u) << tile;
+    Game::Destinations::MASKS[tile]    = destinations;
+    Program::Metrics::observe(Program::Metrics::GENERATION, start.QuadPart);
+
+    return destinations;
+}
+
+// ... ->> Sparse `Game::Evaluation` features of a `getBoard(...)`: +1 per light & -1 per dark occurrence, so both players share every weight; Returns their count
+unsigned char Game::getFeatures(unsigned char const board[], unsigned short indices[], signed char values[]) {
+    unsigned char count = 0u;
+
+    for (unsigned char tile = 64u; tile--; )
+    if (0x00u != board[tile]) {
+        bool const          light    = 0x00u != (board[tile] & 0x80u);
+        signed char         mobility = 0;
+        unsigned char const type     = (board[tile] & 0x7Fu) - 1u;
+        unsigned char const square   = light ? tile : (tile % Game::Tiles::COLUMN_COUNT) + ((Game::Tiles::ROW_COUNT - 1u - (tile / Game::Tiles::COLUMN_COUNT)) * Game::Tiles::COLUMN_COUNT);
+
+        for (uint64_t moves = Game::getMoves(board, tile); 0u != moves; moves &= moves - 1u) ++mobility;
+
+        indices[count] = Game::Evaluation::MATERIAL + type;                  values[count++] = light ? +1 : -1;
+        indices[count] = Game::Evaluation::MOBILITY + type;                  values[count++] = light ? +mobility : -mobility;
+        indices[count] = Game::Evaluation::SQUARES  + (type * 64u) + square; values[count++] = light ? +1 : -1;
+    }
+
+    return count;
+}
+
 Piece Game::getFirstPiece() { return Game::getNextPiece(Piece(NULL)); }
+
+// ... ->> Pseudo-legal destinations of the piece on `tile` of a `getBoard(...)`; `attacking` keeps only the tiles it threatens, i.e.: no pawn pushes
+uint64_t Game::getMoves(unsigned char const board[], unsigned char const tile, bool const attacking) {
+    static signed char const ADJACENT[8][2] = {{-1, -1}, {-1, 0}, {-1, +1}, {0, -1}, {0, +1}, {+1, -1}, {+1, 0}, {+1, +1}};
+    static signed char const JUMP    [8][2] = {{-2, -1}, {-2, +1}, {-1, -2}, {-1, +2}, {+1, -2}, {+1, +2}, {+2, -1}, {+2, +1}};
+
+    signed char const column = tile % Game::Tiles::COLUMN_COUNT;
+    uint64_t          moves  = 0u;
+    unsigned char     player = board[tile] & 0x80u;
+    signed char const row    = tile / Game::Tiles::COLUMN_COUNT;
+
+    if (0x00u == board[tile]) return 0u; // ->> Empty tile
+
+    #define TILE(column, row) ((column) >= 0 && (column) < Game::Tiles::COLUMN_COUNT && (row) >= 0 && (row) < Game::Tiles::ROW_COUNT)
+    #define MOVE(column, row) (moves |= static_cast<uint64_t>(1u) << ((column) + ((row) * Game::Tiles::COLUMN_COUNT)))
+      switch (static_cast<Piece::Type>((board[tile] & 0x7Fu) - 1u)) {
+          case Piece::KING: case Piece::KNIGHT: {
+              signed char const (*const offsets)[2] = Piece::KING == (board[tile] & 0x7Fu) - 1u ? ADJACENT : JUMP;
+
+              for (unsigned char index = 8u; index--; )
+              if (TILE(column + offsets[index][0], row + offsets[index][1])) MOVE(column + offsets[index][0], row + offsets[index][1]);
+          } break;
+
+          case Piece::BISHOP: case Piece::QUEEN: case Piece::ROOK: {
+              unsigned char const type = (board[tile] & 0x7Fu) - 1u;
+
+              for (unsigned char index = 8u; index--; ) {
+                  bool const diagonal = 0 != ADJACENT[index][0] && 0 != ADJACENT[index][1];
+
+                  if ((Piece::BISHOP == type && false == diagonal) || (Piece::ROOK == type && diagonal)) continue;
+                  for (signed char rayColumn = column + ADJACENT[index][0], rayRow = row + ADJACENT[index][1]; TILE(rayColumn, rayRow); rayColumn += ADJACENT[index][0], rayRow += ADJACENT[index][1]) {
+                      MOVE(rayColumn, rayRow);
+                      if (0x00u != board[rayColumn + (rayRow * Game::Tiles::COLUMN_COUNT)]) break;
+                  }
+              }
+          } break;
+
+          case Piece::PAWN: { // ->> Light pawns advance up the rows, dark pawns down
+              signed char const forward = 0x00u != player ? +1 : -1;
+              signed char const start   = 0x00u != player ? 1 : Game::Tiles::ROW_COUNT - 2;
+
+              for (signed char side = -1; side <= +1; side += 2)
+              if (TILE(column + side, row + forward) && (attacking || 0x00u != board[(column + side) + ((row + forward) * Game::Tiles::COLUMN_COUNT)])) MOVE(column + side, row + forward);
+
+              if (false == attacking && TILE(column, row + forward) && 0x00u == board[column + ((row + forward) * Game::Tiles::COLUMN_COUNT)]) {
+                  MOVE(column, row + forward);
+                  if (start == row && 0x00u == board[column + ((row + forward + forward) * Game::Tiles::COLUMN_COUNT)]) MOVE(column, row + forward + forward);
+              }
+          } break;
+
+          default: return 0u;
+      }
+    #undef MOVE
+    #undef TILE
+
+    // ... ->> Never onto the mover's own pieces
+    for (unsigned char destination = 64u; destination--; )
+    if (0x00u != board[destination] && player == (board[destination] & 0x80u)) moves &= ~(static_cast<uint64_t>(1u) << destination);
+
+    return moves;
+}
 Piece Game::getNextPiece (Piece const piece) {
     // if (NULL == piece.data) return Game::getPiece(Player::DARK, Piece::BISHOP, 0u);
     // if (piece.data == Game::getPiece(Player::DARK, Piece::BISHOP, 0u).data) return Game::getPiece(Player::DARK, Piece::BISHOP, 1u);
@@ -293,6 +1315,7 @@ Piece Game::getNextPiece (Piece const piece) {
     Player const      piecePlayer = piece.getPlayer();
     Piece::Type const pieceType   = piece.getType();
 
+    Program::Metrics::count(Program::Metrics::ITERATIONS);
     for (Piece::Type const types[] = {Piece::QUEEN, Piece::KING, Piece::PAWN, Piece::BISHOP, Piece::KNIGHT, Piece::ROOK}, *type = types + (sizeof(types) / sizeof(Piece::Type)); type-- != types; )
     for (Player const players[] = {Player::DARK, Player::LIGHT}, *player = players + (sizeof(players) / sizeof(Player)); player-- != players; )
     for (unsigned char index = Piece::count(*type); index--; ) {
@@ -307,6 +1330,32 @@ Piece Game::getPiece(Player const player, Piece::Type const type, bit<3u> const
     return Piece(Game::addressPieceData(type) + index + (Player::LIGHT == player ? Piece::count(type) : 0u));
 }
 
+DWORD Game::getPieceBitmapColor(unsigned short const x, unsigned short const y) {
+    BYTE const *const row = Game::Pieces::BITMAP_MEMORY + (y * Game::Pieces::BITMAP.bmWidthBytes);
+
+    switch (Game::Pieces::BITMAP.bmBitsPixel) {
+        case 8u : return Game::Pieces::BITMAP_PALETTE[row[x]];
+        case 24u: return (row[(x * 3u) + 2u] << 0x10u) | (row[(x * 3u) + 1u] << 0x08u) | row[(x * 3u) + 0u];
+        case 32u: return reinterpret_cast<UINT32 const*>(row)[x] & 0xFFFFFFu;
+    }
+
+    return 0x000000u;
+}
+
+unsigned char Game::getTile(int const x, int const y) {
+    int const boardX     = x - Game::Board::LEFT;
+    int const boardY     = y - Game::Board::TOP;
+    int const cellHeight = Game::getTileHeight() + Game::Tiles::MARGIN;
+    int const cellWidth  = Game::getTileWidth()  + Game::Tiles::MARGIN;
+
+    if (
+        (boardX > -1 && boardX < cellWidth  * Game::Tiles::COLUMN_COUNT && boardX % cellWidth  >= Game::Tiles::MARGIN && boardX % cellWidth  < cellWidth  - Game::Tiles::MARGIN) &&
+        (boardY > -1 && boardY < cellHeight * Game::Tiles::ROW_COUNT    && boardY % cellHeight >= Game::Tiles::MARGIN && boardY % cellHeight < cellHeight - Game::Tiles::MARGIN)
+    ) return (boardX / cellWidth) + ((boardY / cellHeight) * Game::Tiles::COLUMN_COUNT);
+
+    return Game::Tiles::COLUMN_COUNT * Game::Tiles::ROW_COUNT;
+}
+
 unsigned short Game::getTileHeight() {
     return Game::Board::HEIGHT / Game::Tiles::ROW_COUNT;
 }
@@ -319,76 +1368,654 @@ Player Game::getTurn() {
     return *Game::addressTurnData() & 0x01u ? Player::LIGHT : Player::DARK;
 }
 
-void Game::setPlayerTurn(Player const color) {
-    if (Player::DARK  == color) *Game::addressTurnData() &= 0xFEu;
-    if (Player::LIGHT == color) *Game::addressTurnData() |= 0x01u;
+// ... ->> Whether any `light` (or dark) piece of `board` threatens `tile`
+bool Game::isAttacked(unsigned char const board[], unsigned char const tile, bool const light) {
+    for (unsigned char square = 64u; square--; )
+    if (0x00u != board[square] && light == (0x00u != (board[square] & 0x80u)) && ((Game::getMoves(board, square, true) >> tile) & 0x01u)) return true;
+
+    return false;
 }
 
-// : Pawn
-Piece::Type Pawn::getPromotionType() const {
-    switch (*(this -> data) & 0xC0u) {
-        case 0x0u: return Piece::BISHOP;
-        case 0x1u: return Piece::KNIGHT;
-        case 0x2u: return Piece::QUEEN;
-        case 0x3u: return Piece::ROOK;
+// ... ->> Moves the mover's piece on tile `from` to tile `to`, capturing whatever opposing piece is there; Legality is not checked
+bool Game::move(unsigned char const from, unsigned char const to) {
+    Piece        moved  = Piece(NULL);
+    Piece        target = Piece(NULL);
+    Player const turn   = Game::getTurn();
+
+    if (from == to) return false;
+    for (Piece piece = Game::getFirstPiece(); NULL != piece.data; piece = Game::getNextPiece(piece)) {
+        unsigned char const tile = piece.getColumn() + (piece.getRow() * Game::Tiles::COLUMN_COUNT);
+
+        if (piece.isCaptured()) continue;
+        if (from == tile && turn == piece.getPlayer()) moved  = piece;
+        if (to   == tile                            ) target = piece;
     }
 
-    return Piece::PAWN;
-}
+    if (NULL == moved.data || (NULL != target.data && turn == target.getPlayer())) return false;
+    if (NULL != target.data) moved.capture(target);
+    else moved.setPosition(to % Game::Tiles::COLUMN_COUNT, to / Game::Tiles::COLUMN_COUNT);
 
-bool Pawn::isIncidental() const {
-    unsigned char const count = Piece::count(Piece::PAWN);
-    unsigned char const index = *Game::addressIncidentalPawnData() & 0x0Fu;
+    Game::setPlayerTurn(Player::LIGHT == turn ? Player::DARK : Player::LIGHT);
+    Game::rehash();
+    Program::Metrics::count(Program::Metrics::POSITIONS);
 
-    return this -> data == Game::getPiece(count > index ? Player::DARK : Player::LIGHT, Piece::PAWN, index % count).data;
+    return true;
 }
 
-bool Pawn::isPromoted() const {
-    return (Game::addressPromotedPawnData()[Player::LIGHT == this -> getPlayer() ? 1 : 0] >> this -> getIndex()) & 0x1u;
+// ... ->> `move(...)`, then record it for replay & in the journal
+bool Game::play(unsigned char const from, unsigned char const to) {
+    bool const branched = Game::Replay::PLY != Game::Replay::PLY_COUNT; // ->> Seeked back; No journaled move leads here
+
+    if (false == Game::move(from, to)) return false;
+    Game::Replay::record(from, to);
+    branched ? Game::Journal::snapshot() : Game::Journal::append(from, to);
+
+    return true;
 }
 
-void Pawn::promote(Type const type) {
-    Game::addressPromotedPawnData()[Player::LIGHT == this -> getPlayer() ? 1 : 0] |= 0x1u << this -> getIndex();
+bool Game::setHover(int const x, int const y) {
+    unsigned char const hovered  = Game::Tiles::HOVER;
+    bool const          hovering = Game::Tiles::HOVERED;
+    unsigned char const tile     = Game::getTile(x, y);
 
-    *(this -> data) &= 0x3Fu;
-    switch (type) {
-        case Piece::KING  : break;
-        case Piece::PAWN  : break;
+    Game::Tiles::HOVERED = Game::Tiles::COLUMN_COUNT * Game::Tiles::ROW_COUNT != tile;
+    if (Game::Tiles::HOVERED) Game::Tiles::HOVER = tile;
 
-        case Piece::BISHOP: *(this -> data) |= 0x0u << 6u; break;
-        case Piece::KNIGHT: *(this -> data) |= 0x1u << 6u; break;
-        case Piece::QUEEN : *(this -> data) |= 0x2u << 6u; break;
-        case Piece::ROOK  : *(this -> data) |= 0x3u << 6u; break;
-    }
+    return hovering != Game::Tiles::HOVERED || hovered != Game::Tiles::HOVER;
 }
 
-// : Piece
-void Piece::capture(Piece const piece) {
-    this -> setPosition(piece.getColumn(), piece.getRow());
-    switch (piece.getType()) {
-        // ... ->> Mark the `piece` as "captured"
-        case Piece::KING  : break;
-        case Piece::PAWN  : Game::addressCapturedPawnData   ()[Player::LIGHT == piece.getPlayer() ? 1 : 0] |= 1u << piece.getIndex(); break;
+void Game::setPlayerTurn(Player const color) {
+    if (Player::DARK  == color) *Game::addressTurnData() &= 0xFEu;
+    if (Player::LIGHT == color) *Game::addressTurnData() |= 0x01u;
+}
 
-        case Piece::BISHOP: Game::addressCapturedOfficerData()[0] |= 1u << ((piece.getIndex() + (Player::LIGHT == piece.getPlayer() ? Piece::count(Piece::BISHOP) : 0u)) << 4u); break;
-        case Piece::KNIGHT: Game::addressCapturedOfficerData()[0] |= 1u << ((piece.getIndex() + (Player::LIGHT == piece.getPlayer() ? Piece::count(Piece::KNIGHT) : 0u)) << 0u); break;
-        case Piece::QUEEN : Game::addressCapturedOfficerData()[1] |= 1u << ((piece.getIndex() + (Player::LIGHT == piece.getPlayer() ? Piece::count(Piece::QUEEN ) : 0u)) << 2u); break;
-        case Piece::ROOK  : Game::addressCapturedOfficerData()[1] |= 1u << ((piece.getIndex() + (Player::LIGHT == piece.getPlayer() ? Piece::count(Piece::ROOK  ) : 0u)) << 4u); break;
-    }
+// ... ->> Never blocks: Records are plain stores into the mapped view, left for the system to write back even if the program crashes
+bool Game::Journal::append(unsigned char const from, unsigned char const to) {
+    unsigned char const record[] = {from, to};
+
+    if (++Game::Journal::MOVE_COUNT == Game::Journal::SNAPSHOT_INTERVAL) return Game::Journal::snapshot();
+    return Game::Journal::write(Game::Journal::MOVE, record, sizeof(record));
 }
 
-unsigned char Piece::count(Type const type) {
-    switch (type) {
-        case Piece::BISHOP: case Piece::KNIGHT: case Piece::ROOK: return 2u;
-        case Piece::KING  : case Piece::QUEEN :                   return 1u;
-        case Piece::PAWN  :                                       return 8u;
-    }
+// ... ->> FNV-1a over the `kind` & `size`-byte payload of the record at `offset`, seeded with `offset` so a record never validates elsewhere
+uint32_t Game::Journal::checksum(unsigned char const kind, std::size_t const offset, std::size_t const size) {
+    uint32_t checksum = ((0x811C9DC5u ^ static_cast<uint32_t>(offset)) ^ kind) * 0x01000193u;
 
-    return 0u;
+    for (std::size_t index = 0u; index != size; ++index)
+    checksum = (checksum ^ Game::Journal::VIEW[offset + 1u + index]) * 0x01000193u;
+
+    return checksum;
 }
 
-unsigned char Piece::countTotal() {
-    return (
+// ... ->> Rewrites a `LEGACY_MAGIC` journal in place: Each valid snapshot's turn moves from the low bit of state byte 34 (which doubled as light pawn 0's captured flag) to that of byte 17, & is re-sealed
+bool Game::Journal::migrate() {
+    if (0 != std::memcmp(Game::Journal::VIEW, Game::Journal::LEGACY_MAGIC, sizeof(Game::Journal::LEGACY_MAGIC))) return false;
+
+    for (std::size_t offset = Game::Journal::HEADER_SIZE, size; ; offset += 1u + size + 4u) {
+        unsigned char const kind   = Game::Journal::VIEW[offset];
+        uint32_t            stored = 0u;
+
+        switch (kind) {
+            case Game::Journal::MOVE    : size = 2u ; break;
+            case Game::Journal::SNAPSHOT: size = 35u; break;
+            default: size = 0u;
+        }
+
+        if (0u == size || offset + 1u + size + 4u >= Game::Journal::CAPACITY) break;
+        for (unsigned char index = 4u; index--; ) stored = (stored << 8u) | Game::Journal::VIEW[offset + 1u + size + index];
+        if (stored != Game::Journal::checksum(kind, offset, size)) break;
+
+        if (Game::Journal::SNAPSHOT == kind) {
+            unsigned char *const state = Game::Journal::VIEW + offset + 1u;
+
+            state[17] = (state[17] & 0xFEu) | (state[34] & 0x01u);
+            state[34] &= 0xFEu;
+
+            stored = Game::Journal::checksum(kind, offset, size);
+            for (unsigned char index = 0u; index != 4u; ++index, stored >>= 8u) Game::Journal::VIEW[offset + 1u + size + index] = stored & 0xFFu;
+        }
+    }
+
+    std::memcpy(Game::Journal::VIEW, Game::Journal::MAGIC, sizeof(Game::Journal::MAGIC));
+    return true;
+}
+
+// ... ->> Maps the journal, then restores its latest snapshot and replays only the moves after it
+bool Game::Journal::open() {
+    std::size_t offset   = Game::Journal::HEADER_SIZE;
+    std::size_t snapshot = 0u;
+
+    Game::Journal::FILE = ::CreateFile(Game::Journal::FILE_NAME, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, NULL, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (INVALID_HANDLE_VALUE != Game::Journal::FILE) Game::Journal::FILE_MAPPING = ::CreateFileMapping(Game::Journal::FILE, NULL, PAGE_READWRITE, 0u, Game::Journal::CAPACITY, NULL);
+    if (NULL != Game::Journal::FILE_MAPPING) Game::Journal::VIEW = static_cast<unsigned char*>(::MapViewOfFile(Game::Journal::FILE_MAPPING, FILE_MAP_WRITE, 0u, 0u, Game::Journal::CAPACITY));
+    if (NULL == Game::Journal::VIEW) return false;
+    Game::Journal::migrate();
+
+    // ... ->> Scan from the latest snapshot the header points at, or from the top if that does not validate; Valid records end at the first unknown kind or mismatched checksum, i.e.: wherever the last write was torn
+    if (0 == std::memcmp(Game::Journal::VIEW, Game::Journal::MAGIC, sizeof(Game::Journal::MAGIC))) {
+        std::size_t latest = 0u;
+
+        for (unsigned char index = 4u; index--; ) latest = (latest << 8u) | Game::Journal::VIEW[sizeof(Game::Journal::MAGIC) + index];
+        for (std::size_t start = latest > Game::Journal::HEADER_SIZE && latest < Game::Journal::CAPACITY ? latest : Game::Journal::HEADER_SIZE; ; start = Game::Journal::HEADER_SIZE) {
+            std::size_t size = 0u;
+
+            for (offset = start; ; offset += 1u + size + 4u) {
+                unsigned char const kind   = Game::Journal::VIEW[offset];
+                uint32_t            stored = 0u;
+
+                switch (kind) {
+                    case Game::Journal::MOVE    : size = 2u ; break;
+                    case Game::Journal::SNAPSHOT: size = 35u; break;
+                    default: size = 0u;
+                }
+
+                if (0u == size || offset + 1u + size + 4u >= Game::Journal::CAPACITY) break;
+                for (unsigned char index = 4u; index--; ) stored = (stored << 8u) | Game::Journal::VIEW[offset + 1u + size + index];
+                if (stored != Game::Journal::checksum(kind, offset, size)) break;
+
+                if (Game::Journal::SNAPSHOT == kind) snapshot = offset;
+            }
+
+            if (0u != snapshot || Game::Journal::HEADER_SIZE == start) break;
+        }
+    }
+
+    if (0u == snapshot) {
+        std::memcpy(Game::Journal::VIEW, Game::Journal::MAGIC, sizeof(Game::Journal::MAGIC));
+        Game::Journal::SIZE = Game::Journal::HEADER_SIZE;
+        Game::Journal::setLatest(0u);
+
+        return Game::Journal::snapshot();
+    }
+
+    for (std::size_t index = sizeof(Game::CONTEXT -> memory) / sizeof(bit<8u>); index--; ) Game::CONTEXT -> memory[index] = Game::Journal::VIEW[snapshot + 1u + index];
+    Game::CONTEXT -> accumulated = 0x00u;
+    Game::rehash();
+    Game::Replay::begin();
+
+    for (std::size_t record = snapshot + 1u + 35u + 4u; record != offset; record += 1u + 2u + 4u)
+    if (Game::move(Game::Journal::VIEW[record + 1u], Game::Journal::VIEW[record + 2u])) Game::Replay::record(Game::Journal::VIEW[record + 1u], Game::Journal::VIEW[record + 2u]);
+
+    Game::Journal::MOVE_COUNT = static_cast<unsigned char>((offset - snapshot - (1u + 35u + 4u)) / (1u + 2u + 4u));
+    Game::Journal::SIZE       = offset;
+
+    return true;
+}
+
+// ... ->> Only a hint; `open()` validates the snapshot there before trusting it
+void Game::Journal::setLatest(std::size_t const offset) {
+    for (unsigned char index = 0u; index != 4u; ++index)
+    Game::Journal::VIEW[sizeof(Game::Journal::MAGIC) + index] = (offset >> (index * 8u)) & 0xFFu;
+}
+
+bool Game::Journal::snapshot() {
+    std::size_t   offset;
+    unsigned char record[35];
+
+    for (std::size_t index = sizeof(record); index--; ) record[index] = static_cast<unsigned char>(Game::CONTEXT -> memory[index]);
+    Game::Journal::MOVE_COUNT = 0u;
+
+    if (false == Game::Journal::write(Game::Journal::SNAPSHOT, record, sizeof(record))) return false;
+    offset = Game::Journal::SIZE - (1u + sizeof(record) + 4u);
+    Game::Journal::setLatest(offset);
+
+    return true;
+}
+
+bool Game::Journal::write(unsigned char const kind, unsigned char const record[], std::size_t const size) {
+    std::size_t const offset = Game::Journal::SIZE;
+    uint32_t          checksum;
+
+    if (NULL == Game::Journal::VIEW) return false;
+    if (offset + 1u + size + 4u >= Game::Journal::CAPACITY) { // ->> Full; Start over right after the header from a fresh snapshot, unhinted until it is written
+        Game::Journal::SIZE = Game::Journal::HEADER_SIZE;
+        Game::Journal::setLatest(0u);
+
+        return Game::Journal::snapshot();
+    }
+
+    // ... ->> The kind is stored last & the record after it is cleared first, so a torn write, or a stale record from before a restart, reads as the end
+    Game::Journal::VIEW[offset + 1u + size + 4u] = 0x00u;
+    std::memcpy(Game::Journal::VIEW + offset + 1u, record, size);
+
+    checksum = Game::Journal::checksum(kind, offset, size);
+    for (unsigned char index = 0u; index != 4u; ++index, checksum >>= 8u) Game::Journal::VIEW[offset + 1u + size + index] = checksum & 0xFFu;
+    Game::Journal::VIEW[offset] = kind;
+    Game::Journal::SIZE         = offset + 1u + size + 4u;
+
+    return true;
+}
+
+// ... ->> Adds (or subtracts) one feature's `HIDDEN_COUNT` weights into an accumulator
+void Game::Network::accumulate(int16_t accumulator[], int16_t const weights[], bool const adding) {
+    #if defined(SIMD_AVX2)
+      for (unsigned short index = 0u; index != Game::Network::HIDDEN_COUNT; index += 16u) {
+          __m256i const a = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(accumulator + index));
+          __m256i const b = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(weights     + index));
+
+          _mm256_storeu_si256(reinterpret_cast<__m256i*>(accumulator + index), adding ? _mm256_add_epi16(a, b) : _mm256_sub_epi16(a, b));
+      }
+    #elif defined(SIMD_SSE2)
+      for (unsigned short index = 0u; index != Game::Network::HIDDEN_COUNT; index += 8u) {
+          __m128i const a = _mm_loadu_si128(reinterpret_cast<__m128i const*>(accumulator + index));
+          __m128i const b = _mm_loadu_si128(reinterpret_cast<__m128i const*>(weights     + index));
+
+          _mm_storeu_si128(reinterpret_cast<__m128i*>(accumulator + index), adding ? _mm_add_epi16(a, b) : _mm_sub_epi16(a, b));
+      }
+    #else
+      for (unsigned short index = 0u; index != Game::Network::HIDDEN_COUNT; ++index)
+      accumulator[index] = static_cast<int16_t>(adding ? accumulator[index] + weights[index] : accumulator[index] - weights[index]);
+    #endif
+}
+
+// ... ->> Clipped ReLU onto [0, 127]; `count` is a multiple of 16
+void Game::Network::clamp(int16_t destination[], int16_t const source[], unsigned short const count) {
+    #if defined(SIMD_AVX2)
+      for (unsigned short index = 0u; index != count; index += 16u)
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(destination + index), _mm256_min_epi16(_mm256_max_epi16(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(source + index)), _mm256_setzero_si256()), _mm256_set1_epi16(127)));
+    #elif defined(SIMD_SSE2)
+      for (unsigned short index = 0u; index != count; index += 8u)
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + index), _mm_min_epi16(_mm_max_epi16(_mm_loadu_si128(reinterpret_cast<__m128i const*>(source + index)), _mm_setzero_si128()), _mm_set1_epi16(127)));
+    #else
+      for (unsigned short index = 0u; index != count; ++index)
+      destination[index] = source[index] < 0 ? 0 : source[index] > 127 ? 127 : source[index];
+    #endif
+}
+
+// ... ->> `count` is a multiple of 16; Products of clamped inputs & 8-bit weights never overflow the 32-bit pair sums
+int32_t Game::Network::dot(int16_t const a[], int16_t const b[], unsigned short const count) {
+    #if defined(SIMD_AVX2)
+      __m256i total = _mm256_setzero_si256();
+      __m128i sum;
+
+      for (unsigned short index = 0u; index != count; index += 16u)
+      total = _mm256_add_epi32(total, _mm256_madd_epi16(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(a + index)), _mm256_loadu_si256(reinterpret_cast<__m256i const*>(b + index))));
+
+      sum = _mm_add_epi32(_mm256_castsi256_si128(total), _mm256_extracti128_si256(total, 1));
+      sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0x4E));
+      sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0xB1));
+
+      return _mm_cvtsi128_si32(sum);
+    #elif defined(SIMD_SSE2)
+      __m128i sum = _mm_setzero_si128();
+
+      for (unsigned short index = 0u; index != count; index += 8u)
+      sum = _mm_add_epi32(sum, _mm_madd_epi16(_mm_loadu_si128(reinterpret_cast<__m128i const*>(a + index)), _mm_loadu_si128(reinterpret_cast<__m128i const*>(b + index))));
+
+      sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0x4E));
+      sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0xB1));
+
+      return _mm_cvtsi128_si32(sum);
+    #else
+      int32_t sum = 0;
+
+      for (unsigned short index = 0u; index != count; ++index) sum += static_cast<int32_t>(a[index]) * b[index];
+      return sum;
+    #endif
+}
+
+// ... ->> in centipawns for the light player; The mover's accumulator leads the hidden layer
+int Game::Network::evaluate() {
+    int16_t       hidden[Game::Network::HIDDEN_COUNT * 2u];
+    int16_t       layer [Game::Network::LAYER_COUNT];
+    int32_t       output;
+    LARGE_INTEGER start;
+    bool const    timed = Program::Metrics::sample();
+    Player const  turn  = Game::getTurn();
+
+    if (timed) ::QueryPerformanceCounter(&start);
+    Program::Metrics::count(0x03u == Game::CONTEXT -> accumulated ? Program::Metrics::ACCUMULATOR_HITS : Program::Metrics::ACCUMULATOR_MISSES);
+    if (0x03u != Game::CONTEXT -> accumulated) Game::Network::refresh();
+    Game::Network::clamp(hidden                              , Game::CONTEXT -> accumulators[Player::LIGHT == turn ? 1 : 0], Game::Network::HIDDEN_COUNT);
+    Game::Network::clamp(hidden + Game::Network::HIDDEN_COUNT, Game::CONTEXT -> accumulators[Player::LIGHT == turn ? 0 : 1], Game::Network::HIDDEN_COUNT);
+
+    for (unsigned char index = 0u; index != Game::Network::LAYER_COUNT; ++index) {
+        int32_t const sum = (Game::Network::LAYER_BIASES[index] + Game::Network::dot(hidden, Game::Network::LAYER_WEIGHTS[index], Game::Network::HIDDEN_COUNT * 2u)) >> Game::Network::WEIGHT_SHIFT;
+        layer[index] = static_cast<int16_t>(sum < 0 ? 0 : sum > 127 ? 127 : sum);
+    }
+
+    output = (Game::Network::OUTPUT_BIAS + Game::Network::dot(layer, Game::Network::OUTPUT_WEIGHTS, Game::Network::LAYER_COUNT)) / Game::Network::OUTPUT_SCALE;
+    if (timed) Program::Metrics::observe(Program::Metrics::EVALUATION, start.QuadPart, Program::Metrics::SAMPLE_INTERVAL);
+
+    return Player::LIGHT == turn ? output : -output;
+}
+
+// ... ->> of a `getBoard(...)` tile as seen by `perspective`; Dark sees the board flipped so both players' features read alike
+unsigned Game::Network::getFeature(unsigned char const perspective, unsigned char const king, unsigned char const code, unsigned char const tile) {
+    static unsigned char const TYPES[] = {/* ->> Bishop, King, Knight, Pawn, Queen, Rook */ 0u, 0u, 1u, 2u, 3u, 4u};
+    unsigned char const flip = Player::LIGHT == perspective ? 0x00u : 0x38u;
+    bool const          own  = (Player::LIGHT == perspective) == (0x00u != (code & 0x80u));
+
+    return ((((king ^ flip) * 10u) + TYPES[(code & 0x7Fu) - 1u] + (own ? 0u : 5u)) * 64u) + (tile ^ flip);
+}
+
+// ... ->> `MAGIC`, then little-endian `FEATURE_BIASES`, `FEATURE_WEIGHTS`, `LAYER_BIASES`, `LAYER_WEIGHTS`, `OUTPUT_BIAS` & `OUTPUT_WEIGHTS`
+bool Game::Network::load() {
+    char        magic[sizeof(Game::Network::MAGIC)];
+    std::FILE  *file = NULL != Game::Network::FILE_NAME ? std::fopen(Game::Network::FILE_NAME, "rb") : NULL;
+    bool        loaded;
+    signed char weights[Game::Network::HIDDEN_COUNT * 2u];
+
+    std::free(Game::Network::FEATURE_WEIGHTS);
+    Game::Network::FEATURE_WEIGHTS = NULL != file ? static_cast<int16_t*>(std::malloc(static_cast<std::size_t>(Game::Network::FEATURE_COUNT) * Game::Network::HIDDEN_COUNT * sizeof(int16_t))) : NULL;
+
+    loaded = NULL != Game::Network::FEATURE_WEIGHTS &&
+        1u == std::fread(magic, sizeof(magic), 1u, file) && 0 == std::memcmp(magic, Game::Network::MAGIC, sizeof(magic)) &&
+        Game::Network::HIDDEN_COUNT == std::fread(Game::Network::FEATURE_BIASES, sizeof(int16_t), Game::Network::HIDDEN_COUNT, file) &&
+        static_cast<std::size_t>(Game::Network::FEATURE_COUNT) * Game::Network::HIDDEN_COUNT == std::fread(Game::Network::FEATURE_WEIGHTS, sizeof(int16_t), static_cast<std::size_t>(Game::Network::FEATURE_COUNT) * Game::Network::HIDDEN_COUNT, file) &&
+        Game::Network::LAYER_COUNT == std::fread(Game::Network::LAYER_BIASES, sizeof(int32_t), Game::Network::LAYER_COUNT, file);
+
+    for (unsigned char layer = 0u; loaded && layer != Game::Network::LAYER_COUNT; ++layer) {
+        loaded = sizeof(weights) == std::fread(weights, 1u, sizeof(weights), file);
+        for (unsigned short index = sizeof(weights); index--; ) Game::Network::LAYER_WEIGHTS[layer][index] = weights[index];
+    }
+
+    loaded = loaded && 1u == std::fread(&Game::Network::OUTPUT_BIAS, sizeof(int32_t), 1u, file) && Game::Network::LAYER_COUNT == std::fread(weights, 1u, Game::Network::LAYER_COUNT, file);
+    for (unsigned char index = Game::Network::LAYER_COUNT; loaded && index--; ) Game::Network::OUTPUT_WEIGHTS[index] = weights[index];
+
+    if (NULL != file) std::fclose(file);
+    if (false == loaded) { std::free(Game::Network::FEATURE_WEIGHTS); Game::Network::FEATURE_WEIGHTS = NULL; }
+
+    return Game::Network::LOADED = loaded;
+}
+
+// ... ->> Rebuilds whichever accumulator is not current from every piece on the board
+void Game::Network::refresh() {
+    unsigned char board[64];
+
+    Game::getBoard(board);
+    for (unsigned char perspective = 2u; perspective--; )
+    if (0x00u == ((Game::CONTEXT -> accumulated >> perspective) & 0x01u)) {
+        int16_t *const      accumulator = Game::CONTEXT -> accumulators[perspective];
+        unsigned char const king        = (Piece::KING + 1u) | (Player::LIGHT == perspective ? 0x80u : 0x00u);
+
+        Game::CONTEXT -> kings[perspective] = 0u;
+        for (unsigned char tile = 64u; tile--; ) if (king == board[tile]) Game::CONTEXT -> kings[perspective] = tile;
+
+        std::memcpy(accumulator, Game::Network::FEATURE_BIASES, sizeof(Game::Network::FEATURE_BIASES));
+        for (unsigned char tile = 64u; tile--; )
+        if (0x00u != board[tile] && Piece::KING + 1u != (board[tile] & 0x7Fu))
+        Game::Network::accumulate(accumulator, Game::Network::FEATURE_WEIGHTS + (static_cast<std::size_t>(Game::Network::getFeature(perspective, Game::CONTEXT -> kings[perspective], board[tile], tile)) * Game::Network::HIDDEN_COUNT), true);
+
+        Game::CONTEXT -> accumulated |= 1u << perspective;
+    }
+}
+
+// ... ->> Moves a `getBoard(...)` `code` from tile `from` to `to` (64 for off the board) in each current accumulator; A king move leaves its own player's to be refreshed instead
+void Game::Network::update(unsigned char const code, unsigned char const from, unsigned char const to) {
+    for (unsigned char perspective = 2u; perspective--; )
+    if ((Game::CONTEXT -> accumulated >> perspective) & 0x01u) {
+        if (Piece::KING + 1u == (code & 0x7Fu)) {
+            if ((Player::LIGHT == perspective) == (0x00u != (code & 0x80u))) Game::CONTEXT -> accumulated &= ~(1u << perspective);
+            continue;
+        }
+
+        if (64u != from) Game::Network::accumulate(Game::CONTEXT -> accumulators[perspective], Game::Network::FEATURE_WEIGHTS + (static_cast<std::size_t>(Game::Network::getFeature(perspective, Game::CONTEXT -> kings[perspective], code, from)) * Game::Network::HIDDEN_COUNT), false);
+        if (64u != to  ) Game::Network::accumulate(Game::CONTEXT -> accumulators[perspective], Game::Network::FEATURE_WEIGHTS + (static_cast<std::size_t>(Game::Network::getFeature(perspective, Game::CONTEXT -> kings[perspective], code, to  )) * Game::Network::HIDDEN_COUNT), true);
+    }
+}
+
+// ... ->> Maps `ATLAS_FILE_NAME`; Every size, sprite & row is bounds-checked here so drawing trusts the view
+bool Game::Pieces::loadAtlas() {
+    Game::Pieces::ATLAS_FILE = NULL != Game::Pieces::ATLAS_FILE_NAME ? ::CreateFile(Game::Pieces::ATLAS_FILE_NAME, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL) : INVALID_HANDLE_VALUE;
+
+    if (INVALID_HANDLE_VALUE != Game::Pieces::ATLAS_FILE) Game::Pieces::ATLAS_FILE_SIZE    = ::GetFileSize(Game::Pieces::ATLAS_FILE, NULL);
+    if (Game::Pieces::ATLAS_FILE_SIZE > sizeof(Game::Pieces::ATLAS_MAGIC) + sizeof(uint32_t)) Game::Pieces::ATLAS_FILE_MAPPING = ::CreateFileMapping(Game::Pieces::ATLAS_FILE, NULL, PAGE_READONLY, 0u, 0u, NULL);
+    if (NULL != Game::Pieces::ATLAS_FILE_MAPPING) Game::Pieces::ATLAS_FILE_VIEW = ::MapViewOfFile(Game::Pieces::ATLAS_FILE_MAPPING, FILE_MAP_READ, 0u, 0u, 0u);
+    if (NULL != Game::Pieces::ATLAS_FILE_VIEW) {
+        BYTE const *const                    file  = static_cast<BYTE const*>(Game::Pieces::ATLAS_FILE_VIEW);
+        uint32_t const                       count = *reinterpret_cast<uint32_t const*>(file + sizeof(Game::Pieces::ATLAS_MAGIC));
+        Game::Pieces::AtlasSize const *const sizes = reinterpret_cast<Game::Pieces::AtlasSize const*>(file + sizeof(Game::Pieces::ATLAS_MAGIC) + sizeof(uint32_t));
+        bool                                 valid = 0 == std::memcmp(file, Game::Pieces::ATLAS_MAGIC, sizeof(Game::Pieces::ATLAS_MAGIC)) && 0u != count && count <= (Game::Pieces::ATLAS_FILE_SIZE - sizeof(Game::Pieces::ATLAS_MAGIC) - sizeof(uint32_t)) / sizeof(Game::Pieces::AtlasSize);
+
+        for (uint32_t index = valid ? count : 0u; index--; ) {
+            Game::Pieces::AtlasSprite const *const sprites = reinterpret_cast<Game::Pieces::AtlasSprite const*>(file + sizes[index].offset);
+
+            valid = 0u == sizes[index].offset % 4u && sizes[index].offset <= Game::Pieces::ATLAS_FILE_SIZE && (Game::Pieces::ATLAS_FILE_SIZE - sizes[index].offset) / sizeof(Game::Pieces::AtlasSprite) >= 12u;
+            for (unsigned char sprite = valid ? 12u : 0u; sprite--; ) {
+                Game::Pieces::AtlasSprite const &box = sprites[sprite];
+                valid = valid && 0u == box.offset % 4u && box.offset <= Game::Pieces::ATLAS_FILE_SIZE && box.left + box.width <= sizes[index].width && box.top + box.height <= sizes[index].height && (Game::Pieces::ATLAS_FILE_SIZE - box.offset) / sizeof(UINT32) >= static_cast<DWORD>(box.height) * box.width;
+            }
+
+            if (false == valid) break;
+        }
+
+        if (valid) return true;
+
+        ::UnmapViewOfFile(Game::Pieces::ATLAS_FILE_VIEW);
+        Game::Pieces::ATLAS_FILE_VIEW = NULL;
+    }
+
+    return false;
+}
+
+// ... ->> Maps `BITMAP_FILE_NAME`; 8-, 24- or 32-bit uncompressed, either row order
+bool Game::Pieces::loadBitmap() {
+    Game::Pieces::BITMAP_FILE = NULL != Game::Pieces::BITMAP_FILE_NAME ? ::CreateFile(Game::Pieces::BITMAP_FILE_NAME, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL) : INVALID_HANDLE_VALUE;
+
+    if (INVALID_HANDLE_VALUE != Game::Pieces::BITMAP_FILE) Game::Pieces::BITMAP_FILE_MAPPING = ::CreateFileMapping(Game::Pieces::BITMAP_FILE, NULL, PAGE_READONLY, 0u, 0u, NULL);
+    if (NULL != Game::Pieces::BITMAP_FILE_MAPPING) Game::Pieces::BITMAP_FILE_VIEW = ::MapViewOfFile(Game::Pieces::BITMAP_FILE_MAPPING, FILE_MAP_READ, 0u, 0u, 0u);
+    if (NULL != Game::Pieces::BITMAP_FILE_VIEW) {
+        BYTE const *const             file       = static_cast<BYTE const*>(Game::Pieces::BITMAP_FILE_VIEW);
+        BITMAPFILEHEADER const *const fileHeader = reinterpret_cast<BITMAPFILEHEADER const*>(file);
+        BITMAPINFOHEADER const *const header     = reinterpret_cast<BITMAPINFOHEADER const*>(file + sizeof(BITMAPFILEHEADER));
+        DWORD const                   fileSize   = ::GetFileSize(Game::Pieces::BITMAP_FILE, NULL);
+
+        if (
+            fileSize > sizeof(BITMAPFILEHEADER) + sizeof(BITMAPINFOHEADER) &&
+            0x4D42u == fileHeader -> bfType && BI_RGB == header -> biCompression && header -> biWidth > 0L && header -> biHeight != 0L &&
+            (8u == header -> biBitCount || 24u == header -> biBitCount || 32u == header -> biBitCount)
+        ) {
+            LONG const height = header -> biHeight < 0L ? -header -> biHeight : header -> biHeight;
+            LONG const stride = (((header -> biWidth * header -> biBitCount) + 31L) / 32L) * 4L;
+
+            if (fileHeader -> bfOffBits + static_cast<DWORD>(height * stride) <= fileSize) {
+                RGBQUAD const *const palette      = reinterpret_cast<RGBQUAD const*>(file + sizeof(BITMAPFILEHEADER) + header -> biSize);
+                DWORD const          paletteCount = 0u != header -> biClrUsed ? header -> biClrUsed : 256u;
+
+                if (8u == header -> biBitCount)
+                for (DWORD index = paletteCount < 256u ? paletteCount : 256u; index--; )
+                Game::Pieces::BITMAP_PALETTE[index] = (palette[index].rgbRed << 0x10u) | (palette[index].rgbGreen << 0x08u) | (palette[index].rgbBlue << 0x00u);
+
+                // ... ->> Bottom-up bitmaps are walked from their last row with a negative stride
+                Game::Pieces::BITMAP.bmBitsPixel  = header -> biBitCount;
+                Game::Pieces::BITMAP.bmHeight     = height;
+                Game::Pieces::BITMAP.bmPlanes     = header -> biPlanes;
+                Game::Pieces::BITMAP.bmWidth      = header -> biWidth;
+                Game::Pieces::BITMAP.bmWidthBytes = header -> biHeight < 0L ? +stride : -stride;
+                Game::Pieces::BITMAP.bmBits       = const_cast<BYTE*>(file + fileHeader -> bfOffBits);
+                Game::Pieces::BITMAP_MEMORY       = file + fileHeader -> bfOffBits + (header -> biHeight < 0L ? 0L : (height - 1L) * stride);
+
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+// ... ->> Applies one frame's payload (past its varint length) to `state`
+void Game::Replay::apply(unsigned char state[], unsigned char const payload[], std::size_t const length) {
+    if (0x00u != payload[0]) std::memcpy(state, payload + 3u, sizeof(Game::Replay::STATE));
+    else for (std::size_t cursor = 3u, index = 0u; cursor != length; cursor += 2u) {
+        index += payload[cursor];
+        state[index++] = payload[cursor + 1u];
+    }
+}
+
+// ... ->> Restarts the stream with a keyframe of the current state
+bool Game::Replay::begin() {
+    Game::Replay::OFFSET    = 0u;
+    Game::Replay::PLY       = 0uL;
+    Game::Replay::PLY_COUNT = 0uL;
+    Game::Replay::SIZE      = 0u;
+
+    return Game::Replay::record(Game::Replay::MOVELESS, Game::Replay::MOVELESS);
+}
+
+// ... ->> Appends the ply that just moved `from` → `to`; Recording while seeked back discards every later ply first
+bool Game::Replay::record(unsigned char const from, unsigned char const to) {
+    unsigned long const ply       = Game::Replay::MOVELESS == from ? 0uL : Game::Replay::PLY + 1uL;
+    std::size_t const   stateSize = sizeof(Game::Replay::STATE);
+    bool const          keyframe  = 0uL == ply % Game::Replay::KEYFRAME_INTERVAL;
+    unsigned char       payload[3u + (stateSize * 2u)];
+    std::size_t         payloadSize = 0u;
+    std::size_t         size        = Game::Replay::MOVELESS == from ? 0u : Game::Replay::OFFSET;
+
+    // ... ->> Payload: kind, `from`, `to`, then either the full state or (varint gap, byte) per changed byte
+    payload[payloadSize++] = keyframe;
+    payload[payloadSize++] = from;
+    payload[payloadSize++] = to;
+
+    for (std::size_t index = 0u, previous = 0u; index != stateSize; ++index) {
+        unsigned char const value = static_cast<unsigned char>(Game::CONTEXT -> memory[index]);
+
+        if (keyframe) payload[payloadSize++] = value;
+        else if (value != Game::Replay::STATE[index]) {
+            payload[payloadSize++] = static_cast<unsigned char>(index - previous); // ->> Always under 128, i.e.: a one-byte varint
+            payload[payloadSize++] = value;
+            previous = index + 1u;
+        }
+    }
+
+    // ... ->> Grow the stream & keyframe index geometrically
+    if (size + payloadSize + 2u > Game::Replay::CAPACITY) {
+        std::size_t const    capacity = (Game::Replay::CAPACITY + payloadSize + 2u) * 2u;
+        unsigned char *const stream   = static_cast<unsigned char*>(std::realloc(Game::Replay::STREAM, capacity));
+
+        if (NULL == stream) return false;
+        Game::Replay::CAPACITY = capacity;
+        Game::Replay::STREAM   = stream;
+    }
+
+    if (keyframe) {
+        std::size_t const keyframeCount = ply / Game::Replay::KEYFRAME_INTERVAL;
+
+        if (keyframeCount == Game::Replay::KEYFRAME_CAPACITY) {
+            std::size_t const  capacity  = (Game::Replay::KEYFRAME_CAPACITY + 1u) * 2u;
+            std::size_t *const keyframes = static_cast<std::size_t*>(std::realloc(Game::Replay::KEYFRAMES, capacity * sizeof(std::size_t)));
+
+            if (NULL == keyframes) return false;
+            Game::Replay::KEYFRAME_CAPACITY = capacity;
+            Game::Replay::KEYFRAMES         = keyframes;
+        }
+
+        Game::Replay::KEYFRAMES[keyframeCount] = size;
+    }
+
+    // ... ->> Frame: varint payload length, then the payload
+    for (std::size_t length = payloadSize; ; length >>= 7u) {
+        Game::Replay::STREAM[size++] = (length & 0x7Fu) | (length > 0x7Fu ? 0x80u : 0x00u);
+        if (length <= 0x7Fu) break;
+    }
+
+    std::memcpy(Game::Replay::STREAM + size, payload, payloadSize);
+    for (std::size_t index = stateSize; index--; ) Game::Replay::STATE[index] = static_cast<unsigned char>(Game::CONTEXT -> memory[index]);
+
+    Game::Replay::OFFSET    = Game::Replay::SIZE = size + payloadSize;
+    Game::Replay::PLY       = ply;
+    Game::Replay::PLY_COUNT = ply;
+
+    return true;
+}
+
+// ... ->> Restores the current context to `ply` from the nearest keyframe before it
+bool Game::Replay::seek(unsigned long const ply) {
+    std::size_t offset;
+
+    if (ply > Game::Replay::PLY_COUNT || NULL == Game::Replay::STREAM) return false;
+    offset = Game::Replay::KEYFRAMES[ply / Game::Replay::KEYFRAME_INTERVAL];
+
+    for (unsigned long current = ply - (ply % Game::Replay::KEYFRAME_INTERVAL); ; ++current) {
+        std::size_t length = 0u;
+
+        for (unsigned char shift = 0u; ; shift += 7u) {
+            length |= static_cast<std::size_t>(Game::Replay::STREAM[offset] & 0x7Fu) << shift;
+            if (0x00u == (Game::Replay::STREAM[offset++] & 0x80u)) break;
+        }
+
+        Game::Replay::apply(Game::Replay::STATE, Game::Replay::STREAM + offset, length);
+        offset += length;
+        if (current == ply) break;
+    }
+
+    for (std::size_t index = sizeof(Game::Replay::STATE); index--; ) Game::CONTEXT -> memory[index] = Game::Replay::STATE[index];
+    Game::CONTEXT -> accumulated = 0x00u;
+    Game::Replay::OFFSET = offset;
+    Game::Replay::PLY    = ply;
+    Game::rehash();
+
+    return true;
+}
+
+// : Pawn
+Piece::Type Pawn::getPromotionType() const {
+    switch (*(this -> data) & 0xC0u) {
+        case 0x0u: return Piece::BISHOP;
+        case 0x1u: return Piece::KNIGHT;
+        case 0x2u: return Piece::QUEEN;
+        case 0x3u: return Piece::ROOK;
+    }
+
+    return Piece::PAWN;
+}
+
+bool Pawn::isIncidental() const {
+    unsigned char const count = Piece::count(Piece::PAWN);
+    unsigned char const index = *Game::addressIncidentalPawnData() & 0x0Fu;
+
+    return this -> data == Game::getPiece(count > index ? Player::DARK : Player::LIGHT, Piece::PAWN, index % count).data;
+}
+
+bool Pawn::isPromoted() const {
+    return (Game::addressPromotedPawnData()[Player::LIGHT == this -> getPlayer() ? 1 : 0] >> this -> getIndex()) & 0x1u;
+}
+
+void Pawn::promote(Type const type) {
+    Game::addressPromotedPawnData()[Player::LIGHT == this -> getPlayer() ? 1 : 0] |= 0x1u << this -> getIndex();
+
+    *(this -> data) &= 0x3Fu;
+    switch (type) {
+        case Piece::KING  : break;
+        case Piece::PAWN  : break;
+
+        case Piece::BISHOP: *(this -> data) |= 0x0u << 6u; break;
+        case Piece::KNIGHT: *(this -> data) |= 0x1u << 6u; break;
+        case Piece::QUEEN : *(this -> data) |= 0x2u << 6u; break;
+        case Piece::ROOK  : *(this -> data) |= 0x3u << 6u; break;
+    }
+}
+
+// : Piece
+void Piece::capture(Piece const piece) {
+    this -> setPosition(piece.getColumn(), piece.getRow());
+    switch (piece.getType()) {
+        // ... ->> Mark the `piece` as "captured"
+        case Piece::KING  : break;
+        case Piece::PAWN  : Game::addressCapturedPawnData   ()[Player::LIGHT == piece.getPlayer() ? 1 : 0] |= 1u << piece.getIndex(); break;
+
+        case Piece::BISHOP: Game::addressCapturedOfficerData()[0] |= 1u << (4u + piece.getIndex() + (Player::LIGHT == piece.getPlayer() ? Piece::count(Piece::BISHOP) : 0u)); break;
+        case Piece::KNIGHT: Game::addressCapturedOfficerData()[0] |= 1u << (0u + piece.getIndex() + (Player::LIGHT == piece.getPlayer() ? Piece::count(Piece::KNIGHT) : 0u)); break;
+        case Piece::QUEEN : Game::addressCapturedOfficerData()[1] |= 1u << (2u + piece.getIndex() + (Player::LIGHT == piece.getPlayer() ? Piece::count(Piece::QUEEN ) : 0u)); break;
+        case Piece::ROOK  : Game::addressCapturedOfficerData()[1] |= 1u << (4u + piece.getIndex() + (Player::LIGHT == piece.getPlayer() ? Piece::count(Piece::ROOK  ) : 0u)); break;
+    }
+
+    if (0x00u != Game::CONTEXT -> accumulated)
+    Game::Network::update((piece.getType() + 1u) | (Player::LIGHT == piece.getPlayer() ? 0x80u : 0x00u), piece.getColumn() + (piece.getRow() * Game::Tiles::COLUMN_COUNT), 64u);
+}
+
+unsigned char Piece::count(Type const type) {
+    switch (type) {
+        case Piece::BISHOP: case Piece::KNIGHT: case Piece::ROOK: return 2u;
+        case Piece::KING  : case Piece::QUEEN :                   return 1u;
+        case Piece::PAWN  :                                       return 8u;
+    }
+
+    return 0u;
+}
+
+unsigned char Piece::countTotal() {
+    return (
         Piece::count(Piece::BISHOP) +
         Piece::count(Piece::KING  ) +
         Piece::count(Piece::KNIGHT) +
@@ -399,6 +2026,7 @@ unsigned char Piece::countTotal() {
 }
 
 bit<3u> Piece::getColumn() const {
+    Program::Metrics::count(Program::Metrics::ACCESSES);
     return Piece::BISHOP != this -> getType() ? (this -> getPosition() & 0x38u) >> 0x3u : (
         ((this -> getPosition() * 2u) % Game::Tiles::COLUMN_COUNT) + (this -> getRow() % 2u
             ? this -> getIndex() == (Player::LIGHT == this -> getPlayer() ? 0u : 1u)
@@ -408,6 +2036,7 @@ bit<3u> Piece::getColumn() const {
 }
 
 bit<3u> Piece::getIndex() const {
+    Program::Metrics::count(Program::Metrics::ACCESSES);
     for (Type const types[] = {Piece::QUEEN, Piece::KING, Piece::PAWN, Piece::BISHOP, Piece::KNIGHT, Piece::ROOK}, *type = types + (sizeof(types) / sizeof(Type)); type-- != types; ) {
         for (unsigned char index = Piece::count(*type); index--; )
         if (
@@ -419,142 +2048,2629 @@ bit<3u> Piece::getIndex() const {
     return 0u;
 }
 
-bit<6u> Piece::getPosition() const {
-    Type const type = this -> getType();
+bit<6u> Piece::getPosition() const {
+    Program::Metrics::count(Program::Metrics::ACCESSES);
+    Type const type = this -> getType();
+
+    switch (type) {
+        case Piece::BISHOP: return *(this -> data) & 0x1Fu;
+        case Piece::KNIGHT: case Piece::PAWN: case Piece::ROOK: return *(this -> data) & 0x3Fu;
+        case Piece::KING: case Piece::QUEEN: {
+            Player const color = this -> getPlayer();
+            return (
+                ((*Game::getPiece(color, Piece::BISHOP, Piece::QUEEN == type ? 1u : 0u).data >> 6u) << 4u) |
+                ((*Game::getPiece(color, Piece::KNIGHT, Piece::QUEEN == type ? 1u : 0u).data >> 6u) << 2u) |
+                ((*Game::getPiece(color, Piece::ROOK  , Piece::QUEEN == type ? 1u : 0u).data >> 6u) << 0u)
+            );
+        } break;
+    }
+
+    return 0u;
+}
+
+Player Piece::getPlayer() const {
+    Program::Metrics::count(Program::Metrics::ACCESSES);
+    for (Type const types[] = {Piece::QUEEN, Piece::KING, Piece::PAWN, Piece::BISHOP, Piece::KNIGHT, Piece::ROOK}, *type = types + (sizeof(types) / sizeof(Type)); type-- != types; )
+    for (unsigned char index = Piece::count(*type); index--; ) {
+        if (this -> data == Game::getPiece(Player::DARK , *type, index).data) return Player::DARK;
+        if (this -> data == Game::getPiece(Player::LIGHT, *type, index).data) return Player::LIGHT;
+    }
+
+    return static_cast<Player>(0x0u);
+}
+
+bit<3u> Piece::getRow() const {
+    Program::Metrics::count(Program::Metrics::ACCESSES);
+    return Piece::BISHOP != this -> getType() ? (this -> getPosition() & 0x07u) >> 0x0u : (
+        this -> getPosition() / (Game::Tiles::COLUMN_COUNT / 2u)
+    );
+}
+
+Piece::Type Piece::getType() const {
+    Program::Metrics::count(Program::Metrics::ACCESSES);
+    for (Type const types[] = {Piece::QUEEN, Piece::KING, Piece::PAWN, Piece::BISHOP, Piece::KNIGHT, Piece::ROOK}, *type = types + (sizeof(types) / sizeof(Type)); type-- != types; ) {
+        for (unsigned char index = Piece::count(*type); index--; )
+        if (
+            this -> data == Game::getPiece(Player::DARK , *type, index).data ||
+            this -> data == Game::getPiece(Player::LIGHT, *type, index).data
+        ) return *type;
+    }
+
+    return static_cast<Type>(0x0u);
+}
+
+bool Piece::isCaptured() const {
+    Program::Metrics::count(Program::Metrics::ACCESSES);
+    switch (this -> getType()) {
+        case Piece::KING  : return false;
+        case Piece::PAWN  : return (Game::addressCapturedPawnData()[Player::LIGHT == this -> getPlayer() ? 1 : 0] >> this -> getIndex()) & 0x01u;
+
+        case Piece::BISHOP: return ((Game::addressCapturedOfficerData()[0] >> 4u) >> (this -> getIndex() + (Player::LIGHT == this -> getPlayer() ? Piece::count(Piece::BISHOP) : 0u))) & 0x01u;
+        case Piece::KNIGHT: return ((Game::addressCapturedOfficerData()[0] >> 0u) >> (this -> getIndex() + (Player::LIGHT == this -> getPlayer() ? Piece::count(Piece::KNIGHT) : 0u))) & 0x01u;
+        case Piece::QUEEN : return ((Game::addressCapturedOfficerData()[1] >> 2u) >> (this -> getIndex() + (Player::LIGHT == this -> getPlayer() ? Piece::count(Piece::QUEEN ) : 0u))) & 0x01u;
+        case Piece::ROOK  : return ((Game::addressCapturedOfficerData()[1] >> 4u) >> (this -> getIndex() + (Player::LIGHT == this -> getPlayer() ? Piece::count(Piece::ROOK  ) : 0u))) & 0x01u;
+    }
+
+    return false;
+}
+
+void Piece::setColumn(bit<3u> const column) {
+    this -> setPosition(column, this -> getRow());
+}
+
+void Piece::setPosition(bit<3u> const column, bit<3u> const row) {
+    Type const          type = this -> getType();
+    unsigned char const from = 0x00u != Game::CONTEXT -> accumulated ? static_cast<unsigned char>(this -> getColumn() + (this -> getRow() * Game::Tiles::COLUMN_COUNT)) : 64u; // ->> Only needed by `Game::Network::update(...)`
+
+    switch (type) {
+        case Piece::BISHOP: {
+            Player const color = this -> getPlayer();
+            unsigned char const index = this -> getIndex();
+            unsigned char position = (Game::Tiles::COLUMN_COUNT * Game::Tiles::ROW_COUNT) / 2u;
+
+            while (position--) {
+                unsigned char const positionRow = position / (Game::Tiles::COLUMN_COUNT / 2u);
+                unsigned char const positionColumn = ((position * 2u) % Game::Tiles::COLUMN_COUNT) + (positionRow % 2u
+                    ? index == (Player::LIGHT == color ? 0u : 1u)
+                    : index == (Player::LIGHT == color ? 1u : 0u)
+                );
+
+                if (column == positionColumn && row == positionRow) {
+                    *(this -> data) &= 0xE0u;
+                    *(this -> data) |= position;
+
+                    break;
+                }
+            }
+        } break;
+
+        case Piece::KNIGHT: case Piece::PAWN: case Piece::ROOK: {
+            *(this -> data) &= 0xC0u;
+            *(this -> data) |= (column << 3u) | (row << 0u);
+        } break;
+
+        case Piece::KING: case Piece::QUEEN: {
+            Player const color = this -> getPlayer();
+            bit<8u> *const position[3] = {
+                Game::getPiece(color, Piece::BISHOP, Piece::QUEEN == type ? 1u : 0u).data,
+                Game::getPiece(color, Piece::KNIGHT, Piece::QUEEN == type ? 1u : 0u).data,
+                Game::getPiece(color, Piece::ROOK  , Piece::QUEEN == type ? 1u : 0u).data
+            };
+
+            *position[0] &= 0x3Fu;
+            *position[1] &= 0x3Fu;
+            *position[2] &= 0x3Fu;
+
+            *position[0] |= ((column & 0x06u) >> 1u) << 6u;
+            *position[1] |= ((((column & 0x01u) >> 0u) << 1u) | (((row & 0x04u) >> 2u) << 0u)) << 6u;
+            *position[2] |= ((row    & 0x03u) >> 0u) << 6u;
+        } break;
+    }
+
+    if (64u != from) Game::Network::update((type + 1u) | (Player::LIGHT == this -> getPlayer() ? 0x80u : 0x00u), from, column + (row * Game::Tiles::COLUMN_COUNT));
+}
+
+void Piece::setRow(bit<3u> const row) {
+    this -> setPosition(this -> getColumn(), row);
+}
+
+// : Program
+void Program::exit() { Program::exit(Program::EXIT_CODE); }
+void Program::exit(int const code) {
+    Program::EXIT_CODE = code;
+
+    if (NULL != Program::onexit) (*Program::onexit)();
+    std::exit(Program::EXIT_CODE);
+}
+
+void Program::raise(int const signal) {
+    switch (signal) {
+        case SIGABRT: if (NULL != Program::onabort       ) (*Program::onabort)()       ; break;
+        case SIGFPE : if (NULL != Program::onmathfault   ) (*Program::onmathfault)()   ; break;
+        case SIGILL : if (NULL != Program::oninvalidfault) (*Program::oninvalidfault)(); break;
+        case SIGINT : if (NULL != Program::oninterrupt   ) (*Program::oninterrupt)()   ; break;
+        case SIGSEGV: if (NULL != Program::onsegfault    ) (*Program::onsegfault)()    ; break;
+        case SIGTERM: if (NULL != Program::onterminate   ) (*Program::onterminate)()   ; break;
+    } Program::exit(Program::EXIT_CODE);
+}
+
+// ... ->> Superseded, or out of time or nodes with a move to show for it
+bool Program::Analysis::isCancelled() {
+    LONG const deadline = Program::Analysis::DEADLINE;
+
+    if (Program::Analysis::JOB != Program::Analysis::GENERATION) return true;
+    if (0u == Program::Analysis::COMPLETED) return false;
+
+    if (0 != Program::Analysis::STOP && 0u == (Program::Analysis::NODES & 0x3Fu)) { // ->> Polled every 64 nodes
+        LARGE_INTEGER counter;
+
+        ::QueryPerformanceCounter(&counter);
+        if (counter.QuadPart >= Program::Analysis::STOP) return true;
+    }
+
+    return (0uL != Program::Analysis::NODE_LIMIT && Program::Analysis::NODES >= Program::Analysis::NODE_LIMIT) || (0 != deadline && static_cast<LONG>(::GetTickCount() - static_cast<DWORD>(deadline)) >= 0);
+}
+
+// ... ->> Hands the current position to `THREAD`, cancelling whatever it was searching; A non-zero `deadline` (tick count) bounds the search
+void Program::Analysis::post(DWORD const deadline) {
+    while (0 != ::InterlockedExchange(&Program::Analysis::LOCK, 1)) ::Sleep(0u);
+      Program::Analysis::ROOT = *Game::CONTEXT;
+      ::InterlockedExchange(&Program::Analysis::DEADLINE, static_cast<LONG>(deadline));
+      ::InterlockedIncrement(&Program::Analysis::GENERATION);
+    ::InterlockedExchange(&Program::Analysis::LOCK, 0);
+
+    Program::Analysis::POSTED = Game::CONTEXT -> hash;
+    ::SetEvent(Program::Analysis::SIGNAL);
+}
+
+// ... ->> Publish the snapshot and take back whichever one it replaces, then wake `Simulation::THREAD` to read it
+void Program::Analysis::publish(Program::Analysis::Snapshot const& snapshot) {
+    Program::Analysis::SNAPSHOTS[Program::Analysis::BACK] = snapshot;
+    Program::Analysis::BACK = ::InterlockedExchange(&Program::Analysis::READY, Program::Analysis::BACK | Program::Analysis::FRESH) & ~Program::Analysis::FRESH;
+
+    ::SetEvent(Program::Input::SIGNAL);
+}
+
+DWORD WINAPI Program::Analysis::run(LPVOID const) {
+    while (WAIT_OBJECT_0 == ::WaitForSingleObject(Program::Analysis::SIGNAL, INFINITE) && Program::Simulation::RUNNING) {
+        Game::Context root;
+
+        while (0 != ::InterlockedExchange(&Program::Analysis::LOCK, 1)) ::Sleep(0u);
+          root                    = Program::Analysis::ROOT;
+          Program::Analysis::JOB  = Program::Analysis::GENERATION;
+        ::InterlockedExchange(&Program::Analysis::LOCK, 0);
+
+        // ... ->> Iterative deepening of the posted position, then of the position after its predicted move
+        Game::CONTEXT = &root;
+        if (Game::Network::LOADED) Game::Network::refresh(); // ->> Once, rather than at every leaf
+        for (bool pondering = false; ; pondering = true) {
+            Snapshot snapshot = Snapshot();
+
+            snapshot.hash     = root.hash;
+            snapshot.job      = Program::Analysis::JOB;
+            snapshot.move [0] = snapshot.move [1] = Game::Replay::MOVELESS;
+            snapshot.reply[0] = snapshot.reply[1] = Game::Replay::MOVELESS;
+            Program::Analysis::CANCELLED = false;
+            Program::Analysis::COMPLETED = 0u;
+            Program::Analysis::NODES     = 0uL;
+            if (pondering) Program::Analysis::publish(snapshot); // ->> So `UPDATE()` recognizes the predicted move once played
+
+            for (unsigned char depth = 1u; depth <= Program::Analysis::DEPTH_LIMIT; ++depth) {
+                unsigned char line[4] = {snapshot.move[0], snapshot.move[1], Game::Replay::MOVELESS, Game::Replay::MOVELESS}; // ->> Previous best is tried first
+                int const     score   = Program::Analysis::search(depth, 0u, -Program::Analysis::MATE - 1, +Program::Analysis::MATE + 1, line);
+
+                if (Program::Analysis::CANCELLED) break;
+                Program::Analysis::COMPLETED = depth;
+
+                snapshot.complete = Program::Analysis::DEPTH_LIMIT == depth;
+                snapshot.depth    = depth;
+                snapshot.move [0] = line[0]; snapshot.move [1] = line[1];
+                snapshot.nodes    = Program::Analysis::NODES;
+                snapshot.reply[0] = line[2]; snapshot.reply[1] = line[3];
+                snapshot.score    = score;
+                Program::Analysis::publish(snapshot);
+            }
+
+            if (Program::Analysis::JOB != Program::Analysis::GENERATION || false == Program::Simulation::RUNNING) break;
+            if (false == snapshot.complete) { snapshot.complete = true; Program::Analysis::publish(snapshot); } // ->> Out of time
+
+            // ... ->> Only the human's position is pondered past
+            if (pondering || Program::Analysis::PLAYER == Game::getTurn() || Game::Replay::MOVELESS == snapshot.move[0]) break;
+            Game::move(snapshot.move[0], snapshot.move[1]);
+        }
+
+        Game::CONTEXT = &Game::DEFAULT;
+    }
+
+    return 0u;
+}
+
+// ... ->> Negamax with alpha-beta pruning over copies of `Game::CONTEXT`, scored for the mover; `line` holds the best move found (tried first if set) & the best answer to it
+int Program::Analysis::search(unsigned char const depth, unsigned char const ply, int alpha, int const beta, unsigned char line[]) {
+    unsigned char        board[64];
+    unsigned short       captures = 0u, count = 0u;
+    bool const           light    = Player::LIGHT == Game::getTurn();
+    unsigned char        moves[256][2];
+    Game::Context *const parent   = Game::CONTEXT;
+
+    ++Program::Analysis::NODES;
+    Program::Metrics::count(Program::Metrics::NODES);
+    Program::Metrics::flush();
+    if (Program::Analysis::isCancelled()) { Program::Analysis::CANCELLED = true; return 0; }
+
+    if (0u == depth) {
+        float score;
+
+        if (Game::Network::LOADED && Program::Analysis::NETWORK) score = static_cast<float>(Game::Network::evaluate());
+        else { Game::getBoard(board); score = Game::evaluate(board); }
+
+        return static_cast<int>(light ? score : -score);
+    }
+
+    // ... ->> Captures first, then the suggested move ahead of everything
+    Game::getBoard(board);
+    for (unsigned char tile = 0u; tile != 64u; ++tile)
+    if (0x00u != board[tile] && light == (0x00u != (board[tile] & 0x80u)))
+    for (uint64_t destinations = Game::getDestinations(tile); 0u != destinations; destinations &= destinations - 1u) {
+        unsigned char destination = 0u;
+
+        while (0u == ((destinations >> destination) & 0x01u)) ++destination;
+        moves[count][0] = tile; moves[count][1] = destination;
+
+        if (0x00u != board[destination]) {
+            moves[count][0] = moves[captures][0]; moves[count][1] = moves[captures][1];
+            moves[captures][0] = tile; moves[captures][1] = destination;
+            ++captures;
+        }
+
+        ++count;
+    }
+
+    if (0u == count) { // ->> Checkmated, or stalemated
+        for (unsigned char tile = 64u; tile--; )
+        if (((Piece::KING + 1u) | (light ? 0x80u : 0x00u)) == board[tile]) return Game::isAttacked(board, tile, false == light) ? ply - Program::Analysis::MATE : 0;
+
+        return 0;
+    }
+
+    for (unsigned short index = 0u; index != count; ++index)
+    if (line[0] == moves[index][0] && line[1] == moves[index][1]) {
+        moves[index][0] = moves[0][0]; moves[index][1] = moves[0][1];
+        moves[0][0] = line[0]; moves[0][1] = line[1];
+        break;
+    }
+
+    line[0] = line[1] = line[2] = line[3] = Game::Replay::MOVELESS;
+    for (unsigned short index = 0u; index != count; ++index) {
+        Game::Context child      = *parent;
+        unsigned char answer[4]  = {Game::Replay::MOVELESS, Game::Replay::MOVELESS, Game::Replay::MOVELESS, Game::Replay::MOVELESS};
+        int           score;
+
+        Game::CONTEXT = &child;
+          Game::move(moves[index][0], moves[index][1]);
+          score = -Program::Analysis::search(depth - 1u, ply + 1u, -beta, -alpha, answer);
+        Game::CONTEXT = parent;
+
+        if (Program::Analysis::CANCELLED) return 0;
+        if (score > alpha || Game::Replay::MOVELESS == line[0]) {
+            line[0] = moves[index][0]; line[1] = moves[index][1];
+            line[2] = answer[0];       line[3] = answer[1];
+
+            if (score > alpha) alpha = score;
+            if (alpha >= beta) break;
+        }
+    }
+
+    return alpha;
+}
+
+// ... ->> Picks one of the side to move's legal moves with `random`; False if it has none
+bool Program::Benchmark::choose(uint32_t& random, unsigned char move[]) {
+    unsigned char board[64];
+    unsigned      choice, count = 0u;
+
+    Game::getBoard(board);
+    for (unsigned char tile = 64u; tile--; )
+    if (0x00u != board[tile] && (Player::LIGHT == Game::getTurn()) == (0x00u != (board[tile] & 0x80u))) for (uint64_t destinations = Game::getDestinations(tile); 0u != destinations; destinations &= destinations - 1u) ++count;
+
+    if (0u == count) return false;
+    random ^= random << 13u; random ^= random >> 17u; random ^= random << 5u;
+    choice = random % count;
+
+    for (unsigned char tile = 64u; tile--; )
+    if (0x00u != board[tile] && (Player::LIGHT == Game::getTurn()) == (0x00u != (board[tile] & 0x80u)))
+    for (unsigned char destination = 0u; destination != 64u; ++destination)
+    if ((Game::getDestinations(tile) >> destination) & 0x01u) if (0u == choice--) { move[0] = tile; move[1] = destination; }
+
+    return true;
+}
+
+// ... ->> Sizes given, else this work area's & those of common ones, as `INITIATE()` would lay out the board
+int Program::Atlas::main(char const arguments[]) {
+    static LONG const HEIGHTS[] = {728L, 860L, 1040L, 1160L, 1400L, 2120L}; // ->> 768, 900, 1080, 1200, 1440 & 2160 rows less a taskbar
+    Game::Pieces::AtlasSprite  boxes [Program::Atlas::SIZE_LIMIT][12];
+    std::FILE                 *file             = NULL;
+    UINT32                    *images[Program::Atlas::SIZE_LIMIT] = {NULL};
+    uint32_t                   offset;
+    unsigned short             sizes [Program::Atlas::SIZE_LIMIT];
+    unsigned char              sizeCount        = 0u;
+    bool                       written          = false;
+    RECT                       workareaBounds;
+
+    Game::Pieces::ATLAS_FILE_NAME  = "pieces.atlas";
+    Game::Pieces::BITMAP_FILE_NAME = "pieces.bmp";
+    if (false == Game::Pieces::loadBitmap()) { std::fprintf(stderr, "Unable to load \"%s\"\n", Game::Pieces::BITMAP_FILE_NAME); return EXIT_FAILURE; }
+
+    for (int length = 0; sizeCount != Program::Atlas::SIZE_LIMIT && 1 == std::sscanf(arguments, " %hu%n", sizes + sizeCount, &length); arguments += length)
+    if (0u != sizes[sizeCount]) ++sizeCount;
+
+    if (0u == sizeCount) {
+        if (FALSE != ::SystemParametersInfo(SPI_GETWORKAREA, 0x0000u, static_cast<PVOID>(&workareaBounds), 0x0u)) {
+            LONG const height = ((workareaBounds.bottom - workareaBounds.top) * 3) / 4;
+            LONG const width  = ((workareaBounds.right - workareaBounds.left) * 3) / 4;
+
+            sizes[sizeCount++] = static_cast<unsigned short>((((((height < width ? height : width) * 9) / 10) / Game::Tiles::ROW_COUNT) * 2) / 3);
+        }
+
+        for (unsigned char index = 0u; index != sizeof(HEIGHTS) / sizeof(*HEIGHTS); ++index) {
+            unsigned short const size = static_cast<unsigned short>(((((((HEIGHTS[index] * 3) / 4) * 9) / 10) / Game::Tiles::ROW_COUNT) * 2) / 3);
+
+            for (unsigned char other = sizeCount; ; ) {
+                if (0u == other--) { sizes[sizeCount++] = size; break; }
+                if (size == sizes[other]) break;
+            }
+        }
+    }
+
+    // ... ->> Each piece pixel averages the bitmap pixels it covers; Mask-colored ones count as transparent
+    for (unsigned char index = 0u; index != sizeCount; ++index) {
+        unsigned short const bitmapHeight    = Game::Pieces::BITMAP.bmHeight / 2u;
+        unsigned short const bitmapWidth     = Game::Pieces::BITMAP.bmWidth  / 6u;
+        DWORD const          bitmapMaskColor = Game::getPieceBitmapColor(0u, 0u);
+        unsigned short const size            = sizes[index];
+
+        images[index] = static_cast<UINT32*>(std::malloc(12u * size * size * sizeof(UINT32)));
+        if (NULL == images[index]) { std::fputs("Unable to allocate the atlas\n", stderr); sizeCount = index; break; }
+
+        for (unsigned char sprite = 12u; sprite--; ) {
+            Game::Pieces::AtlasSprite &box    = boxes[index][sprite];
+            unsigned short             bottom = 0u, left = size, right = 0u, top = size;
+
+            for (unsigned short y = 0u; y != size; ++y)
+            for (unsigned short x = 0u; x != size; ++x) {
+                unsigned long        coverage = 0uL, total = 0uL, red = 0uL, green = 0uL, blue = 0uL;
+                unsigned short const fromX    = (x * bitmapWidth ) / size, toX = ((x + 1u) * bitmapWidth ) / size > fromX ? ((x + 1u) * bitmapWidth ) / size : fromX + 1u;
+                unsigned short const fromY    = (y * bitmapHeight) / size, toY = ((y + 1u) * bitmapHeight) / size > fromY ? ((y + 1u) * bitmapHeight) / size : fromY + 1u;
+                UINT32               pixel;
+
+                for (unsigned short bitmapY = fromY; bitmapY != toY; ++bitmapY)
+                for (unsigned short bitmapX = fromX; bitmapX != toX; ++bitmapX, ++total) {
+                    DWORD const color = Game::getPieceBitmapColor(((sprite % 6u) * bitmapWidth) + bitmapX, ((sprite / 6u) * bitmapHeight) + bitmapY);
+                    if (bitmapMaskColor == color) continue;
+
+                    ++coverage;
+                    red   += (color >> 0x10u) & 0xFFu;
+                    green += (color >> 0x08u) & 0xFFu;
+                    blue  += (color >> 0x00u) & 0xFFu;
+                }
+
+                pixel = (((((coverage * 0xFFuL) + (total / 2uL)) / total) << 24u) | ((((red + (total / 2uL)) / total) << 0x10u) | (((green + (total / 2uL)) / total) << 0x08u) | ((blue + (total / 2uL)) / total)));
+                images[index][x + (y * size) + (sprite * size * size)] = pixel;
+
+                if (0x00000000u != (pixel & 0xFF000000u)) {
+                    if (x <  left  ) left   = x;
+                    if (x >= right ) right  = x + 1u;
+                    if (y <  top   ) top    = y;
+                    if (y >= bottom) bottom = y + 1u;
+                }
+            }
+
+            box.height = left < right ? bottom - top : 0u;
+            box.left   = left < right ? left         : 0u;
+            box.top    = left < right ? top          : 0u;
+            box.width  = left < right ? right - left : 0u;
+        }
+    }
+
+    // ... ->> Sizes, then every size's sprites, then every sprite's rows; All records are multiples of four bytes
+    offset = sizeof(Game::Pieces::ATLAS_MAGIC) + sizeof(uint32_t) + (sizeCount * sizeof(Game::Pieces::AtlasSize)) + (sizeCount * 12u * sizeof(Game::Pieces::AtlasSprite));
+    for (unsigned char index = 0u; index != sizeCount; ++index)
+    for (unsigned char sprite = 0u; sprite != 12u; ++sprite) {
+        boxes[index][sprite].offset = offset;
+        offset += boxes[index][sprite].height * boxes[index][sprite].width * sizeof(UINT32);
+    }
+
+    file = 0u != sizeCount ? std::fopen(Game::Pieces::ATLAS_FILE_NAME, "wb") : NULL;
+    if (NULL != file) {
+        uint32_t const count = sizeCount;
+
+        written = 1u == std::fwrite(Game::Pieces::ATLAS_MAGIC, sizeof(Game::Pieces::ATLAS_MAGIC), 1u, file) && 1u == std::fwrite(&count, sizeof(count), 1u, file);
+        for (unsigned char index = 0u; written && index != sizeCount; ++index) {
+            Game::Pieces::AtlasSize const size = {sizes[index], sizes[index], static_cast<uint32_t>(sizeof(Game::Pieces::ATLAS_MAGIC) + sizeof(uint32_t) + (sizeCount * sizeof(Game::Pieces::AtlasSize)) + (index * 12u * sizeof(Game::Pieces::AtlasSprite)))};
+            written = 1u == std::fwrite(&size, sizeof(size), 1u, file);
+        }
+
+        for (unsigned char index = 0u; written && index != sizeCount; ++index)
+        written = 12u == std::fwrite(boxes[index], sizeof(Game::Pieces::AtlasSprite), 12u, file);
+
+        for (unsigned char index = 0u; written && index != sizeCount; ++index) {
+            for (unsigned char sprite = 0u; written && sprite != 12u; ++sprite)
+            for (unsigned short y = 0u; written && y != boxes[index][sprite].height; ++y)
+            written = boxes[index][sprite].width == std::fwrite(images[index] + boxes[index][sprite].left + ((boxes[index][sprite].top + y) * sizes[index]) + (sprite * sizes[index] * sizes[index]), sizeof(UINT32), boxes[index][sprite].width, file);
+
+            std::printf("%hupx pieces: %lu bytes trimmed from %lu\n", sizes[index], static_cast<unsigned long>((index + 1u != sizeCount ? boxes[index + 1u][0].offset : offset) - boxes[index][0].offset), static_cast<unsigned long>(12u * sizes[index] * sizes[index] * sizeof(UINT32)));
+        }
+
+        written = 0 == std::fclose(file) && written;
+    }
+
+    for (unsigned char index = 0u; index != Program::Atlas::SIZE_LIMIT; ++index) std::free(images[index]);
+    ::UnmapViewOfFile(Game::Pieces::BITMAP_FILE_VIEW);
+    ::CloseHandle(Game::Pieces::BITMAP_FILE_MAPPING);
+    ::CloseHandle(Game::Pieces::BITMAP_FILE);
+
+    if (false == written) { std::fprintf(stderr, "Unable to write \"%s\"\n", Game::Pieces::ATLAS_FILE_NAME); return EXIT_FAILURE; }
+    std::printf("%s: %lu bytes, %u sizes\n", Game::Pieces::ATLAS_FILE_NAME, static_cast<unsigned long>(offset), static_cast<unsigned>(sizeCount));
+
+    return EXIT_SUCCESS;
+}
+
+int Program::Benchmark::main(char const arguments[]) {
+    static char const *const NAMES[] = {"forward", "incremental", "refreshed"};
+    LARGE_INTEGER frequency;
+    unsigned char moves[64][2];
+    unsigned long nodes          = 1000000uL;
+    char          path[MAX_PATH] = "ChessNetwork.nnue";
+    unsigned char plies          = 0u;
+    Game::Context positions[64]; // ->> before each of `moves`, with current accumulators
+    uint32_t      random         = 0x9E3779B9u;
+
+    std::sscanf(arguments, "%259s %lu", path, &nodes);
+    ::QueryPerformanceFrequency(&frequency);
+
+    // ... ->> Pointer replay: short random steps across a 1024×768 window laid out as `INITIATE()` would; Counts the hover changes that would repaint
+    Game::Board::HEIGHT = Game::Board::WIDTH = (768 * 9) / 10;
+    Game::Tiles::MARGIN = 2u;
+    Game::Board::LEFT   = (1024 - (Game::Board::WIDTH  + (Game::Tiles::MARGIN * (Game::Tiles::COLUMN_COUNT - 1)))) / 2;
+    Game::Board::TOP    = (768  - (Game::Board::HEIGHT + (Game::Tiles::MARGIN * (Game::Tiles::ROW_COUNT    - 1)))) / 2;
+
+    do {
+        LARGE_INTEGER end, start;
+        unsigned long repaints = 0uL;
+        uint32_t      step     = 0x2545F491u;
+        int           x        = 512, y = 384;
+
+        ::QueryPerformanceCounter(&start);
+        for (unsigned long point = 0uL; point != nodes; ++point) {
+            step ^= step << 13u; step ^= step >> 17u; step ^= step << 5u;
+            x = (x + 1024 + static_cast<int>(step % 33u) - 16) % 1024;
+            y = (y + 768  + static_cast<int>((step >> 8u) % 33u) - 16) % 768;
+
+            repaints += Game::setHover(x, y);
+        }
+
+        ::QueryPerformanceCounter(&end);
+        std::printf("%-11s %lu points in %.3fs, %.0f points/s (%lu repaints)\n", "hover", nodes, static_cast<double>(end.QuadPart - start.QuadPart) / frequency.QuadPart, nodes / (static_cast<double>(end.QuadPart - start.QuadPart) / frequency.QuadPart), repaints);
+    } while (false);
+
+    // ... ->> Replay: a random game of up to 256 plies recorded, then random seeks into it, then its stream written frame by frame down a pipe per subscriber (two per core) as a live broadcast to spectators would be
+    RESET();
+    Game::Replay::begin();
+    for (unsigned char move[2]; Game::Replay::PLY_COUNT != 256uL && Program::Benchmark::choose(random, move); ) {
+        Game::move(move[0], move[1]);
+        Game::Replay::record(move[0], move[1]);
+    }
+
+    do {
+        LARGE_INTEGER end, start;
+        unsigned long checksum = 0uL;
+        uint32_t      step     = 0x2545F491u;
+
+        ::QueryPerformanceCounter(&start);
+        for (unsigned long seek = 0uL; seek != nodes; ++seek) {
+            step ^= step << 13u; step ^= step >> 17u; step ^= step << 5u;
+            Game::Replay::seek(step % (Game::Replay::PLY_COUNT + 1uL));
+            checksum += static_cast<unsigned long>(Game::CONTEXT -> hash);
+        }
+
+        ::QueryPerformanceCounter(&end);
+        std::printf("%-11s %lu seeks in %.3fs, %.0f seeks/s (%lu plies, %.1f bytes/ply, checksum %lu)\n", "seek", nodes, static_cast<double>(end.QuadPart - start.QuadPart) / frequency.QuadPart, nodes / (static_cast<double>(end.QuadPart - start.QuadPart) / frequency.QuadPart), Game::Replay::PLY_COUNT, static_cast<double>(Game::Replay::SIZE) / (Game::Replay::PLY_COUNT + 1uL), checksum);
+    } while (false);
+
+    do {
+        LARGE_INTEGER                  end, start;
+        unsigned long                  frames, mismatches = 0uL, rounds;
+        unsigned                       subscriberCount = 0u, subscriberLimit;
+        Program::Benchmark::Subscriber subscribers[64];
+        SYSTEM_INFO                    systemInformation;
+        ::HANDLE                       threads[64], writers[64];
+
+        ::GetSystemInfo(&systemInformation);
+        Game::Replay::seek(Game::Replay::PLY_COUNT);
+        subscriberLimit = systemInformation.dwNumberOfProcessors < 32u ? systemInformation.dwNumberOfProcessors * 2u : 64u;
+        rounds          = nodes / ((Game::Replay::PLY_COUNT + 1uL) * subscriberLimit);
+        rounds          = 0uL != rounds ? rounds : 1uL;
+
+        for (; subscriberCount != subscriberLimit; ++subscriberCount) {
+            Program::Benchmark::Subscriber &subscriber = subscribers[subscriberCount];
+
+            if (FALSE == ::CreatePipe(&subscriber.pipe, writers + subscriberCount, NULL, 0u)) break;
+            subscriber.frames = 0uL;
+            std::memset(subscriber.state, 0x00, sizeof(subscriber.state));
+
+            threads[subscriberCount] = ::CreateThread(NULL, 0u, &Program::Benchmark::subscribe, &subscriber, 0x0u, NULL);
+            if (NULL == threads[subscriberCount]) { ::CloseHandle(subscriber.pipe); ::CloseHandle(writers[subscriberCount]); break; }
+        }
+
+        ::QueryPerformanceCounter(&start);
+        for (unsigned long round = 0uL; round != rounds; ++round)
+        for (std::size_t offset = 0u, size; offset != Game::Replay::SIZE; offset += size) {
+            std::size_t length = 0u;
+
+            size = 0u;
+            for (unsigned char shift = 0u; ; shift += 7u) {
+                length |= static_cast<std::size_t>(Game::Replay::STREAM[offset + size] & 0x7Fu) << shift;
+                if (0x00u == (Game::Replay::STREAM[offset + size++] & 0x80u)) break;
+            }
+
+            size += length;
+            for (unsigned index = 0u; index != subscriberCount; ++index) {
+                DWORD written;
+                ::WriteFile(writers[index], Game::Replay::STREAM + offset, static_cast<DWORD>(size), &written, NULL);
+            }
+        }
+
+        for (unsigned index = 0u; index != subscriberCount; ++index) ::CloseHandle(writers[index]);
+        ::WaitForMultipleObjects(subscriberCount, threads, TRUE, INFINITE);
+        ::QueryPerformanceCounter(&end);
+
+        for (unsigned index = 0u; index != subscriberCount; ++index) {
+            mismatches += 0 != std::memcmp(subscribers[index].state, Game::Replay::STATE, sizeof(Game::Replay::STATE)) || subscribers[index].frames != rounds * (Game::Replay::PLY_COUNT + 1uL);
+            ::CloseHandle(subscribers[index].pipe);
+            ::CloseHandle(threads[index]);
+        }
+
+        frames = rounds * (Game::Replay::PLY_COUNT + 1uL) * subscriberCount;
+        std::printf("%-11s %lu frames to %u subscribers in %.3fs, %.0f frames/s, %.0f subscribers/core at a move a second (%lu mismatched)\n", "fan-out", frames, subscriberCount, static_cast<double>(end.QuadPart - start.QuadPart) / frequency.QuadPart, frames / (static_cast<double>(end.QuadPart - start.QuadPart) / frequency.QuadPart), frames / (static_cast<double>(end.QuadPart - start.QuadPart) / frequency.QuadPart) / systemInformation.dwNumberOfProcessors, mismatches);
+    } while (false);
+
+    Game::Network::FILE_NAME = path;
+    if (false == Game::Network::load()) { std::fprintf(stderr, "Unable to load network \"%s\"\n", path); return EXIT_FAILURE; }
+
+    // ... ->> A random game from the start position
+    RESET();
+    for (; plies != 64u && Program::Benchmark::choose(random, moves[plies]); ++plies) {
+        Game::Network::evaluate();
+        positions[plies] = *Game::CONTEXT;
+        Game::move(moves[plies][0], moves[plies][1]);
+    }
+
+    // ... ->> Each node restores a position, then evaluates it as is, after a move updating the accumulators, or after a move with them rebuilt
+    for (unsigned char mode = 0u; 0u != plies && mode != 3u; ++mode) {
+        LARGE_INTEGER end, start;
+        long          checksum = 0L;
+
+        ::QueryPerformanceCounter(&start);
+        for (unsigned long node = 0uL; node != nodes; ++node) {
+            unsigned char const ply = node % plies;
+
+            *Game::CONTEXT = positions[ply];
+            if (0u != mode) Game::move(moves[ply][0], moves[ply][1]);
+            if (2u == mode) Game::CONTEXT -> accumulated = 0x00u;
+
+            checksum += Game::Network::evaluate();
+        }
+
+        ::QueryPerformanceCounter(&end);
+        std::printf("%-11s %lu nodes in %.3fs, %.0f nodes/s (%s, checksum %ld)\n", NAMES[mode], nodes, static_cast<double>(end.QuadPart - start.QuadPart) / frequency.QuadPart, nodes / (static_cast<double>(end.QuadPart - start.QuadPart) / frequency.QuadPart), Game::Network::INSTRUCTIONS, checksum);
+    }
+
+    std::free(Game::Network::FEATURE_WEIGHTS);
+    return EXIT_SUCCESS;
+}
+
+// ... ->> Subscriber thread: Splits the pipe's bytes into varint-framed frames & applies each to its own state, until the writing end closes
+DWORD WINAPI Program::Benchmark::subscribe(LPVOID const parameter) {
+    Program::Benchmark::Subscriber &subscriber = *static_cast<Program::Benchmark::Subscriber*>(parameter);
+    unsigned char buffer[4096];
+    unsigned char frame[3u + (sizeof(Game::Replay::STATE) * 2u)];
+    bool          framing = false;
+    std::size_t   length  = 0u, size = 0u;
+    DWORD         read;
+    unsigned char shift   = 0u;
+
+    while (FALSE != ::ReadFile(subscriber.pipe, buffer, sizeof(buffer), &read, NULL) && 0u != read)
+    for (DWORD index = 0u; index != read; ++index) {
+        if (false == framing) {
+            length |= static_cast<std::size_t>(buffer[index] & 0x7Fu) << shift;
+            shift  += 7u;
+            if (0x00u == (buffer[index] & 0x80u)) { framing = true; size = 0u; }
+        }
+
+        else {
+            frame[size++] = buffer[index];
+            if (size != length) continue;
+
+            Game::Replay::apply(subscriber.state, frame, length);
+            ++subscriber.frames;
+            framing = false; length = 0u; shift = 0u;
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
+
+// ... ->> Hands the worker's batch to the writer, then takes an emptied one back, yielding until there is one
+bool Program::Generator::flush(Program::Generator::Worker& worker) {
+    if (NULL != worker.batch && 0u != worker.batch -> count) {
+        while (false == Program::Generator::push(worker.full, worker.batch)) ::Sleep(0u);
+        worker.batch = NULL;
+    }
+
+    while (NULL == worker.batch && false == Program::Generator::pop(worker.empty, worker.batch)) ::Sleep(0u);
+    return true;
+}
+
+int Program::Generator::main(char const arguments[]) {
+    LARGE_INTEGER frequency, end, start;
+    unsigned long games          = 100uL;
+    unsigned      depth          = Program::Generator::DEPTH;
+    char          path[MAX_PATH] = {'\0'};
+    unsigned long samples        = 0uL;
+    SYSTEM_INFO   systemInformation;
+    ::HANDLE      threads[64];
+    ::HANDLE      writer         = NULL;
+
+    ::GetSystemInfo(&systemInformation);
+    ::QueryPerformanceFrequency(&frequency);
+    Program::Generator::WORKER_COUNT = systemInformation.dwNumberOfProcessors < 64u ? (systemInformation.dwNumberOfProcessors > 1u ? systemInformation.dwNumberOfProcessors : 1u) : 64u;
+
+    if (std::sscanf(arguments, "%259s %lu %u %lu", path, &games, &depth, &Program::Generator::NODES) < 1 || 0u == depth || depth > 0xFFu) { std::fputs("usage: --generate file [games] [depth] [nodes]\n", stderr); return EXIT_FAILURE; }
+    Program::Generator::DEPTH = static_cast<unsigned char>(depth);
+    Program::Generator::GAMES = static_cast<LONG>(games);
+
+    Game::Network::FILE_NAME = "ChessNetwork.nnue"; // ->> Scored by the linear evaluation otherwise
+    Game::Network::load();
+
+    // ... ->> A new corpus is headed by `MAGIC`; An existing one is only appended to if it has it
+    Program::Generator::FILE    = std::fopen(path, "a+b");
+    Program::Generator::WORKERS = static_cast<Worker*>(std::calloc(Program::Generator::WORKER_COUNT, sizeof(Worker)));
+    if (NULL != Program::Generator::FILE) {
+        char magic[sizeof(Program::Generator::MAGIC)];
+        bool headed = 0 == ::_fseeki64(Program::Generator::FILE, 0, SEEK_END) && 0 == ::_ftelli64(Program::Generator::FILE) ?
+          1u == std::fwrite(Program::Generator::MAGIC, sizeof(Program::Generator::MAGIC), 1u, Program::Generator::FILE) :
+          0 == std::fseek(Program::Generator::FILE, 0L, SEEK_SET) && 1u == std::fread(magic, sizeof(magic), 1u, Program::Generator::FILE) && 0 == std::memcmp(magic, Program::Generator::MAGIC, sizeof(magic));
+
+        if (false == headed || 0 != std::fseek(Program::Generator::FILE, 0L, SEEK_END)) {
+            std::fprintf(stderr, "\"%s\" is not a %.4s corpus; Generate into a new file\n", path, Program::Generator::MAGIC);
+            std::fclose(Program::Generator::FILE);
+            Program::Generator::FILE = NULL;
+        }
+    }
+
+    if (NULL == Program::Generator::FILE || NULL == Program::Generator::WORKERS) {
+        std::fprintf(stderr, "Unable to generate into \"%s\"\n", path);
+        if (NULL != Program::Generator::FILE) std::fclose(Program::Generator::FILE);
+        std::free(Program::Generator::WORKERS);
+        std::free(Game::Network::FEATURE_WEIGHTS);
+
+        return EXIT_FAILURE;
+    }
+
+    // ... ->> Every worker starts with all its batches empty
+    ::QueryPerformanceCounter(&start);
+    Program::Generator::RUNNING = static_cast<LONG>(Program::Generator::WORKER_COUNT);
+
+    for (DWORD index = 0u; index != Program::Generator::WORKER_COUNT; ++index) {
+        Worker &worker = Program::Generator::WORKERS[index];
+
+        worker.random = 0x9E3779B9u ^ (index * 0x85EBCA6Bu) ^ ::GetTickCount();
+        for (unsigned char batch = 0u; batch != Program::Generator::BATCH_COUNT; ++batch) Program::Generator::push(worker.empty, worker.batches + batch);
+    }
+
+    Program::Metrics::start();
+    writer = ::CreateThread(NULL, 0u, &Program::Generator::write, NULL, 0x0u, NULL);
+    for (DWORD index = 0u; index != Program::Generator::WORKER_COUNT; ++index) {
+        threads[index] = NULL != writer ? ::CreateThread(NULL, 0u, &Program::Generator::run, Program::Generator::WORKERS + index, 0x0u, NULL) : NULL;
+        if (NULL == threads[index]) ::InterlockedDecrement(&Program::Generator::RUNNING);
+    }
+
+    // ... ->> Progress every second until the writer drains the last batch
+    if (NULL == writer) Program::Generator::write(NULL);
+    else for (DWORD state = WAIT_TIMEOUT; WAIT_TIMEOUT == state; ) {
+        state = ::WaitForSingleObject(writer, 1000u);
+        ::QueryPerformanceCounter(&end);
+
+        samples = 0uL;
+        for (DWORD index = 0u; index != Program::Generator::WORKER_COUNT; ++index) samples += Program::Generator::WORKERS[index].samples;
+
+        std::printf("%lu samples in %.1fs, %.0f samples/s, %.0f samples/s per core\n", samples, static_cast<double>(end.QuadPart - start.QuadPart) / frequency.QuadPart, samples / (static_cast<double>(end.QuadPart - start.QuadPart) / frequency.QuadPart), samples / (static_cast<double>(end.QuadPart - start.QuadPart) / frequency.QuadPart) / Program::Generator::WORKER_COUNT);
+    }
+
+    for (DWORD index = 0u; index != Program::Generator::WORKER_COUNT; ++index)
+    if (NULL != threads[index]) { ::WaitForSingleObject(threads[index], INFINITE); ::CloseHandle(threads[index]); }
+
+    if (NULL != writer) ::CloseHandle(writer);
+    Program::Metrics::stop();
+    std::fclose(Program::Generator::FILE);
+    std::free(Program::Generator::WORKERS);
+    std::free(Game::Network::FEATURE_WEIGHTS);
+
+    return EXIT_SUCCESS;
+}
+
+bool Program::Generator::pop(Program::Generator::Ring& ring, Program::Generator::Batch*& batch) {
+    LONG const read = ring.read;
+
+    if (read == ring.write) return false;
+    batch = ring.batches[read % Program::Generator::BATCH_COUNT];
+    ::InterlockedExchange(&ring.read, read + 1);
+
+    return true;
+}
+
+bool Program::Generator::push(Program::Generator::Ring& ring, Program::Generator::Batch* const batch) {
+    LONG const write = ring.write;
+
+    if (write - ring.read == static_cast<LONG>(Program::Generator::BATCH_COUNT)) return false;
+    ring.batches[write % Program::Generator::BATCH_COUNT] = batch;
+    ::InterlockedExchange(&ring.write, write + 1);
+
+    return true;
+}
+
+// ... ->> Plays games until `GAMES` runs out; A game's samples are kept until its result is known
+DWORD WINAPI Program::Generator::run(LPVOID const parameter) {
+    Game::Context  context = Game::Context();
+    unsigned char *game    = static_cast<unsigned char*>(std::malloc(Program::Generator::PLY_LIMIT * Program::Generator::RECORD_SIZE));
+    Worker *const  worker  = static_cast<Worker*>(parameter);
+
+    Game::CONTEXT                 = &context;
+    Program::Analysis::NODE_LIMIT = Program::Generator::NODES;
+
+    while (NULL != game && ::InterlockedDecrement(&Program::Generator::GAMES) >= 0) {
+        std::size_t   count  = 0u;
+        unsigned char result = 1u;
+
+        RESET();
+        for (unsigned short ply = 0u; ply != Program::Generator::PLY_LIMIT; ++ply) {
+            unsigned char board[64];
+            bool          checked = false;
+            bool const    light   = Player::LIGHT == Game::getTurn();
+            unsigned char line[4] = {Game::Replay::MOVELESS, Game::Replay::MOVELESS, Game::Replay::MOVELESS, Game::Replay::MOVELESS};
+            unsigned      moves   = 0u;
+            int           score   = 0;
+
+            Game::getBoard(board);
+            for (unsigned char tile = 64u; tile--; ) {
+                if (((Piece::KING + 1u) | (light ? 0x80u : 0x00u)) == board[tile]) checked = Game::isAttacked(board, tile, false == light);
+                if (ply < Program::Generator::RANDOM_PLIES && 0x00u != board[tile] && light == (0x00u != (board[tile] & 0x80u)))
+                for (uint64_t destinations = Game::getDestinations(tile); 0u != destinations; destinations &= destinations - 1u) ++moves;
+            }
+
+            // ... ->> Random opening move, else the searched one
+            if (ply < Program::Generator::RANDOM_PLIES) {
+                if (0u != moves) {
+                    worker -> random ^= worker -> random << 13u; worker -> random ^= worker -> random >> 17u; worker -> random ^= worker -> random << 5u;
+                    moves = worker -> random % moves;
+
+                    for (unsigned char tile = 64u; tile--; )
+                    if (0x00u != board[tile] && light == (0x00u != (board[tile] & 0x80u)))
+                    for (uint64_t destinations = Game::getDestinations(tile); 0u != destinations; destinations &= destinations - 1u)
+                    if (0u == moves--) { line[0] = tile; for (line[1] = 0u; 0u == ((destinations >> line[1]) & 0x01u); ) ++line[1]; }
+                }
+            }
+
+            else {
+                Program::Analysis::CANCELLED = false;
+                Program::Analysis::COMPLETED = 0u;
+                Program::Analysis::NODES     = 0uL;
+                if (Game::Network::LOADED) Game::Network::refresh(); // ->> Once, rather than at every leaf
+
+                for (unsigned char depth = 1u; depth <= Program::Generator::DEPTH; ++depth) {
+                    unsigned char best[4] = {line[0], line[1], Game::Replay::MOVELESS, Game::Replay::MOVELESS};
+                    int const     value   = Program::Analysis::search(depth, 0u, -Program::Analysis::MATE - 1, +Program::Analysis::MATE + 1, best);
+
+                    if (Program::Analysis::CANCELLED) break;
+                    Program::Analysis::COMPLETED = depth;
+                    line[0] = best[0]; line[1] = best[1];
+                    score   = value;
+                }
+            }
+
+            if (Game::Replay::MOVELESS == line[0]) { result = checked ? (light ? 0u : 2u) : 1u; break; } // ->> Mated, or stalemated
+            if (score >= +Program::Generator::DECISIVE) { result = light ? 2u : 0u; break; }
+            if (score <= -Program::Generator::DECISIVE) { result = light ? 0u : 2u; break; }
+
+            // ... ->> Quiet positions only: not in check, and not best answered by a capture
+            if (ply >= Program::Generator::RANDOM_PLIES && false == checked && 0x00u == board[line[1]]) {
+                unsigned char *const sample = game + (count++ * Program::Generator::RECORD_SIZE);
+                int const            value  = light ? score : -score;
+
+                for (unsigned char index = 35u; index--; ) sample[index] = static_cast<unsigned char>(context.memory[index]);
+                sample[35] = static_cast<unsigned char>(static_cast<uint16_t>(static_cast<int16_t>(value)) & 0xFFu);
+                sample[36] = static_cast<unsigned char>(static_cast<uint16_t>(static_cast<int16_t>(value)) >> 8u);
+            }
+
+            Game::move(line[0], line[1]);
+        }
+
+        // ... ->> Copied out in batch-sized runs
+        for (std::size_t index = 0u; index != count; ++index) {
+            game[(index * Program::Generator::RECORD_SIZE) + 37u] = result;
+            if (NULL == worker -> batch || Program::Generator::BATCH_CAPACITY == worker -> batch -> count) Program::Generator::flush(*worker);
+
+            std::memcpy(worker -> batch -> samples + (worker -> batch -> count++ * Program::Generator::RECORD_SIZE), game + (index * Program::Generator::RECORD_SIZE), Program::Generator::RECORD_SIZE);
+        }
+
+        ::InterlockedExchangeAdd(&worker -> samples, static_cast<LONG>(count));
+    }
+
+    if (NULL != worker -> batch && 0u != worker -> batch -> count)
+    while (false == Program::Generator::push(worker -> full, worker -> batch)) ::Sleep(0u);
+
+    std::free(game);
+    Game::CONTEXT = &Game::DEFAULT;
+    ::InterlockedDecrement(&Program::Generator::RUNNING);
+
+    return 0u;
+}
+
+// ... ->> The only thread touching `FILE`: Drains every worker's full batches as whole writes until they have all finished
+DWORD WINAPI Program::Generator::write(LPVOID const) {
+    for (;;) {
+        bool const finished = 0 == Program::Generator::RUNNING; // ->> Read first, so batches pushed before it are still drained below
+        bool       idle     = true;
+
+        for (DWORD index = 0u; index != Program::Generator::WORKER_COUNT; ++index) {
+            Batch  *batch;
+            Worker &worker = Program::Generator::WORKERS[index];
+
+            while (Program::Generator::pop(worker.full, batch)) {
+                std::fwrite(batch -> samples, Program::Generator::RECORD_SIZE, batch -> count, Program::Generator::FILE);
+                batch -> count = 0u;
+                idle           = false;
+
+                Program::Generator::push(worker.empty, batch);
+            }
+        }
+
+        if (finished && idle) break;
+        if (idle) ::Sleep(1u);
+    }
+
+    std::fflush(Program::Generator::FILE);
+    return 0u;
+}
+
+// ... ->> Positions are added in ascending order, so each lands in the last container & arrays stay sorted by appending
+bool Program::Index::add(Program::Index::Postings& postings, uint32_t const position) {
+    uint16_t const chunk     = static_cast<uint16_t>(position >> 16u);
+    uint16_t const value     = static_cast<uint16_t>(position & 0xFFFFu);
+    Container     *container = 0u != postings.count ? postings.containers + (postings.count - 1u) : NULL;
+
+    if (NULL == container || chunk != container -> chunk) {
+        if (postings.count == postings.capacity) {
+            uint32_t const capacity   = 0u != postings.capacity ? postings.capacity * 2u : 4u;
+            Container     *containers = static_cast<Container*>(std::realloc(postings.containers, capacity * sizeof(Container)));
+
+            if (NULL == containers) return false;
+            postings.capacity   = capacity;
+            postings.containers = containers;
+        }
+
+        container                = postings.containers + postings.count++;
+        container -> capacity    = 0u;
+        container -> cardinality = 0u;
+        container -> chunk       = chunk;
+        container -> values      = NULL;
+    }
+
+    if (container -> cardinality < Program::Index::ARRAY_LIMIT) {
+        if (container -> cardinality == container -> capacity) {
+            uint32_t const capacity = 0u != container -> capacity ? container -> capacity * 2u : 16u;
+            void *const    values   = std::realloc(container -> values, capacity * sizeof(uint16_t));
+
+            if (NULL == values) return false;
+            container -> capacity = capacity;
+            container -> values   = values;
+        }
+
+        static_cast<uint16_t*>(container -> values)[container -> cardinality] = value;
+    }
+
+    else {
+        if (Program::Index::ARRAY_LIMIT == container -> cardinality) { // ->> Array to bitmap
+            uint64_t *const bitmap = static_cast<uint64_t*>(std::calloc(65536u / 64u, sizeof(uint64_t)));
+
+            if (NULL == bitmap) return false;
+            for (uint32_t index = container -> cardinality; index--; ) bitmap[static_cast<uint16_t*>(container -> values)[index] >> 6u] |= 1uLL << (static_cast<uint16_t*>(container -> values)[index] & 0x3Fu);
+
+            std::free(container -> values);
+            container -> capacity = 65536u;
+            container -> values   = bitmap;
+        }
+
+        static_cast<uint64_t*>(container -> values)[value >> 6u] |= 1uLL << (value & 0x3Fu);
+    }
+
+    ++container -> cardinality;
+    ++postings.cardinality;
+
+    return true;
+}
+
+// ... ->> Postings of a material `signature`; Added (growing the table past half full) only if `inserting`
+Program::Index::Postings* Program::Index::find(uint64_t const signature, bool const inserting) {
+    if (inserting && Program::Index::MATERIAL_COUNT * 2u >= Program::Index::MATERIAL_CAPACITY) {
+        std::size_t const capacity  = 0u != Program::Index::MATERIAL_CAPACITY ? Program::Index::MATERIAL_CAPACITY * 2u : 64u;
+        Material *const   materials = static_cast<Material*>(std::calloc(capacity, sizeof(Material)));
+
+        if (NULL == materials) return NULL;
+        for (std::size_t index = 0u; index != Program::Index::MATERIAL_CAPACITY; ++index)
+        if (0u != Program::Index::MATERIALS[index].signature)
+        for (std::size_t slot = static_cast<std::size_t>((Program::Index::MATERIALS[index].signature * 0x9E3779B97F4A7C15uLL) >> 32u) & (capacity - 1u); ; slot = (slot + 1u) & (capacity - 1u))
+        if (0u == materials[slot].signature) { materials[slot] = Program::Index::MATERIALS[index]; break; }
+
+        std::free(Program::Index::MATERIALS);
+        Program::Index::MATERIAL_CAPACITY = capacity;
+        Program::Index::MATERIALS         = materials;
+    }
+
+    if (0u != Program::Index::MATERIAL_CAPACITY)
+    for (std::size_t slot = static_cast<std::size_t>((signature * 0x9E3779B97F4A7C15uLL) >> 32u) & (Program::Index::MATERIAL_CAPACITY - 1u); ; slot = (slot + 1u) & (Program::Index::MATERIAL_CAPACITY - 1u)) {
+        if (signature == Program::Index::MATERIALS[slot].signature) return &Program::Index::MATERIALS[slot].postings;
+        if (0u        == Program::Index::MATERIALS[slot].signature) {
+            if (false == inserting) break;
+
+            ++Program::Index::MATERIAL_COUNT;
+            Program::Index::MATERIALS[slot].signature = signature;
+            return &Program::Index::MATERIALS[slot].postings;
+        }
+    }
+
+    return NULL;
+}
+
+// ... ->> Number of positions in every list; Shortest lists lead, and each chunk is settled by filtering its smallest container through the rest, or by AND-ing bitmaps when all of them are
+uint64_t Program::Index::intersect(Program::Index::Postings* const lists[], unsigned char count) {
+    std::size_t cursors[Program::Index::KEY_LIMIT] = {0u};
+    uint64_t    matches                            = 0u;
+    Postings   *sorted [Program::Index::KEY_LIMIT];
+
+    for (unsigned char index = 0u; index != count; ++index) {
+        unsigned char position = index;
+
+        if (NULL == lists[index]) return 0u;
+        for (; 0u != position && sorted[position - 1u] -> cardinality > lists[index] -> cardinality; --position) sorted[position] = sorted[position - 1u];
+        sorted[position] = lists[index];
+    }
+
+    if (0u != count)
+    for (uint32_t index = 0u; index != sorted[0] -> count; ++index) {
+        Container const *containers[Program::Index::KEY_LIMIT] = {sorted[0] -> containers + index};
+        unsigned char    list                                  = 1u;
+        unsigned char    smallest                              = 0u;
+
+        // ... ->> Chunks ascend in every list, so cursors only move forward
+        for (; list != count; ++list) {
+            Postings const &postings = *sorted[list];
+
+            while (cursors[list] != postings.count && postings.containers[cursors[list]].chunk < containers[0] -> chunk) ++cursors[list];
+            if (cursors[list] == postings.count) return matches;
+            if (postings.containers[cursors[list]].chunk != containers[0] -> chunk) break;
+
+            containers[list] = postings.containers + cursors[list];
+            if (containers[list] -> cardinality < containers[smallest] -> cardinality) smallest = list;
+        }
+
+        if (list != count) continue;
+        if (containers[smallest] -> cardinality <= Program::Index::ARRAY_LIMIT) { // ->> Filter a copy of the smallest array through every other container
+            uint32_t size = containers[smallest] -> cardinality;
+            uint16_t values[Program::Index::ARRAY_LIMIT];
+
+            std::memcpy(values, containers[smallest] -> values, size * sizeof(uint16_t));
+            for (list = 0u; 0u != size && list != count; ++list)
+            if (list != smallest) {
+                Container const &container = *containers[list];
+                uint32_t         kept      = 0u;
+
+                if (container.cardinality > Program::Index::ARRAY_LIMIT) {
+                    for (uint32_t element = 0u; element != size; ++element)
+                    if ((static_cast<uint64_t const*>(container.values)[values[element] >> 6u] >> (values[element] & 0x3Fu)) & 0x01u) values[kept++] = values[element];
+                }
+
+                else for (uint32_t element = 0u, other = 0u; element != size && other != container.cardinality; ) {
+                    uint16_t const value = static_cast<uint16_t const*>(container.values)[other];
+
+                    if      (values[element] < value) ++element;
+                    else if (values[element] > value) ++other;
+                    else { values[kept++] = values[element++]; ++other; }
+                }
+
+                size = kept;
+            }
+
+            matches += size;
+        }
+
+        else for (unsigned short word = 0u; word != 65536u / 64u; ++word) {
+            uint64_t bits = ~0uLL;
+
+            for (list = 0u; list != count; ++list) bits &= static_cast<uint64_t const*>(containers[list] -> values)[word];
+            bits    -= (bits >> 1u) & 0x5555555555555555uLL;
+            bits     = (bits & 0x3333333333333333uLL) + ((bits >> 2u) & 0x3333333333333333uLL);
+            bits     = (bits + (bits >> 4u)) & 0x0F0F0F0F0F0F0F0FuLL;
+            matches += (bits * 0x0101010101010101uLL) >> 56u;
+        }
+    }
+
+    return matches;
+}
+
+int Program::Index::main(char const arguments[]) {
+    unsigned char *boards    = NULL;
+    std::size_t    bytes     = 0u;
+    int            consumed  = 0;
+    unsigned long  copies    = 1uL;
+    unsigned char *corpus    = NULL;
+    std::size_t    count     = 0u;
+    LARGE_INTEGER  frequency;
+    char           path[MAX_PATH] = {'\0'};
+    bool           succeeded = true;
+
+    ::QueryPerformanceFrequency(&frequency);
+    if (std::sscanf(arguments, "%259s%n", path, &consumed) < 1) { std::fputs("usage: --index corpus [copies] query[; query...]\n", stderr); return EXIT_FAILURE; }
+    arguments += consumed;
+    if (1 == std::sscanf(arguments, "%lu%n", &copies, &consumed)) arguments += consumed;
+
+    // ... ->> Same corpus as `Tuner`, read & decoded once
+    corpus = Program::Tuner::load(path, count);
+
+    boards = static_cast<unsigned char*>(std::malloc(count * 64u));
+    if (0u == count || 0uL == copies || NULL == boards || NULL == corpus || count * copies > 0xFFFFFFFFuL) {
+        std::fprintf(stderr, "Unable to index \"%s\"\n", path);
+        succeeded = false;
+    }
+
+    else {
+        LARGE_INTEGER  end, start;
+        Game::Context  context = Game::Context();
+        char const    *query   = arguments;
+
+        Game::CONTEXT = &context;
+          for (std::size_t position = 0u; position != count; ++position) {
+              for (unsigned char index = 35u; index--; ) context.memory[index] = corpus[(position * Program::Tuner::RECORD_SIZE) + index];
+              Game::getBoard(boards + (position * 64u));
+          }
+        Game::CONTEXT = &Game::DEFAULT;
+
+        // ... ->> `copies` repetitions of the corpus stand in for a larger collection
+        ::QueryPerformanceCounter(&start);
+        for (unsigned long copy = 0uL; succeeded && copy != copies; ++copy)
+        for (std::size_t position = 0u; succeeded && position != count; ++position) {
+            unsigned char const *const board     = boards + (position * 64u);
+            uint32_t const             id        = static_cast<uint32_t>((copy * count) + position);
+            Postings                  *material;
+            uint64_t                   signature = 0u;
+
+            for (unsigned char tile = 0u; succeeded && tile != 64u; ++tile)
+            if (0x00u != board[tile]) {
+                unsigned char const key = ((board[tile] & 0x7Fu) - 1u) + (0x00u != (board[tile] & 0x80u) ? 6u : 0u);
+
+                signature += 1uLL << (key * 4u);
+                succeeded  = Program::Index::add(Program::Index::PIECES[key][tile], id);
+            }
+
+            material  = Program::Index::find(signature, true);
+            succeeded = succeeded && NULL != material && Program::Index::add(*material, id);
+        }
+
+        ::QueryPerformanceCounter(&end);
+        for (std::size_t key = 0u; key != (12u * 64u) + Program::Index::MATERIAL_CAPACITY; ++key) {
+            Postings const &postings = key < 12u * 64u ? Program::Index::PIECES[key / 64u][key % 64u] : Program::Index::MATERIALS[key - (12u * 64u)].postings;
+
+            bytes += postings.capacity * sizeof(Container);
+            for (uint32_t index = 0u; index != postings.count; ++index) bytes += postings.containers[index].cardinality > Program::Index::ARRAY_LIMIT ? 65536u / 8u : postings.containers[index].capacity * sizeof(uint16_t);
+        }
+
+        if (false == succeeded) std::fputs("Out of memory while indexing\n", stderr);
+        else std::printf("indexed %lu positions in %.3fs, %lu material signatures, %.1f MiB\n", static_cast<unsigned long>(count * copies), static_cast<double>(end.QuadPart - start.QuadPart) / frequency.QuadPart, static_cast<unsigned long>(Program::Index::MATERIAL_COUNT), bytes / 1048576.0);
+
+        // ... ->> Each query is repeated for at least a quarter second for a stable latency
+        while (succeeded && '\0' != *query) {
+            char const *const next  = std::strchr(query, ';');
+            char              text[256];
+            std::size_t const length = (NULL != next ? static_cast<std::size_t>(next - query) : std::strlen(query)) < sizeof(text) - 1u ? (NULL != next ? static_cast<std::size_t>(next - query) : std::strlen(query)) : sizeof(text) - 1u;
+            Postings         *lists[Program::Index::KEY_LIMIT];
+            unsigned char     keys;
+
+            std::memcpy(text, query, length);
+            text[length] = '\0';
+            query        = NULL != next ? next + 1 : query + std::strlen(query);
+            keys         = Program::Index::parse(text, lists);
+
+            if (0xFFu == keys) std::fprintf(stderr, "Unable to parse query \"%s\"\n", text);
+            else if (0u != keys) {
+                uint64_t      matches = 0u;
+                unsigned long runs    = 0uL;
+
+                ::QueryPerformanceCounter(&start);
+                do { matches = Program::Index::intersect(lists, keys); ++runs; ::QueryPerformanceCounter(&end); }
+                while (end.QuadPart - start.QuadPart < frequency.QuadPart / 4);
+
+                std::printf("%s: %lu matches, %.1f us/query\n", text, static_cast<unsigned long>(matches), (static_cast<double>(end.QuadPart - start.QuadPart) * 1000000.0) / (frequency.QuadPart * static_cast<double>(runs)));
+            }
+        }
+    }
+
+    for (unsigned short key = 0u; key != 12u * 64u; ++key) Program::Index::release(Program::Index::PIECES[key / 64u][key % 64u]);
+    for (std::size_t index = 0u; index != Program::Index::MATERIAL_CAPACITY; ++index) Program::Index::release(Program::Index::MATERIALS[index].postings);
+
+    std::free(Program::Index::MATERIALS);
+    std::free(boards);
+    std::free(corpus);
+
+    return succeeded ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// ... ->> Space-separated keys: a piece & tile such as `Ne5` (upper-case for light; files `a`-`h` are columns, ranks `1`-`8` rows), or `=` then every piece such as `=KQkq` for an exact material signature; `0xFF` if malformed
+unsigned char Program::Index::parse(char const query[], Program::Index::Postings* lists[]) {
+    static char const TYPES[] = "BKNPQR"; // ->> `Piece::Type` order
+    unsigned char     count   = 0u;
+
+    for (char const *token = query; ; ) {
+        while (' ' == *token || '\t' == *token) ++token;
+        if ('\0' == *token) break;
+        if (count == Program::Index::KEY_LIMIT) return 0xFFu;
+
+        if ('=' == *token) {
+            uint64_t signature = 0u;
+
+            for (++token; '\0' != *token && ' ' != *token && '\t' != *token; ++token) {
+                char const *const type = std::strchr(TYPES, std::toupper(static_cast<unsigned char>(*token)));
+
+                if (NULL == type || '\0' == *type) return 0xFFu;
+                signature += 1uLL << (((type - TYPES) + (std::isupper(static_cast<unsigned char>(*token)) ? 6u : 0u)) * 4u);
+            }
+
+            lists[count++] = Program::Index::find(signature, false);
+        }
+
+        else {
+            char const *const type = '\0' != *token ? std::strchr(TYPES, std::toupper(static_cast<unsigned char>(*token))) : NULL;
+
+            if (NULL == type || '\0' == *type || token[1] < 'a' || token[1] > 'h' || token[2] < '1' || token[2] > '8' || ('\0' != token[3] && ' ' != token[3] && '\t' != token[3])) return 0xFFu;
+            lists[count++] = &Program::Index::PIECES[(type - TYPES) + (std::isupper(static_cast<unsigned char>(*token)) ? 6u : 0u)][(token[1] - 'a') + ((token[2] - '1') * Game::Tiles::COLUMN_COUNT)];
+            token += 3;
+        }
+    }
+
+    return count;
+}
+
+void Program::Index::release(Program::Index::Postings& postings) {
+    for (uint32_t index = 0u; index != postings.count; ++index) std::free(postings.containers[index].values);
+    std::free(postings.containers);
+
+    postings.capacity   = postings.count = 0u;
+    postings.cardinality = 0u;
+    postings.containers  = NULL;
+}
+
+bool Program::Input::pop(Program::Input::Event& event) {
+    LONG const read = Program::Input::READ;
+
+    if (read == ::InterlockedCompareExchange(&Program::Input::WRITE, 0, 0)) return false;
+    event = Program::Input::EVENTS[read % Program::Input::CAPACITY];
+
+    ::InterlockedExchange(&Program::Input::READ, read + 1); // ->> Release the slot only after it was copied
+    return true;
+}
+
+bool Program::Input::push(UINT const message, WPARAM const parameter, LPARAM const subparameter) {
+    LARGE_INTEGER time;
+    LONG const    write = Program::Input::WRITE;
+
+    if (write - ::InterlockedCompareExchange(&Program::Input::READ, 0, 0) == Program::Input::CAPACITY) return false;
+    ::QueryPerformanceCounter(&time);
+
+    Program::Input::EVENTS[write % Program::Input::CAPACITY].message      = message;
+    Program::Input::EVENTS[write % Program::Input::CAPACITY].parameter    = parameter;
+    Program::Input::EVENTS[write % Program::Input::CAPACITY].subparameter = subparameter;
+    Program::Input::EVENTS[write % Program::Input::CAPACITY].time         = time.QuadPart;
+
+    ::InterlockedExchange(&Program::Input::WRITE, write + 1); // ->> Publish only after the slot is filled
+    ::SetEvent(Program::Input::SIGNAL);
+
+    return true;
+}
+
+DWORD WINAPI Program::Load::spin(LPVOID const) {
+    uint32_t volatile sink   = 0u;
+    uint32_t          random = 0x9E3779B9u;
+
+    while (Program::Simulation::RUNNING) {
+        for (unsigned short iteration = 0u; iteration != 4096u; ++iteration) { random ^= random << 13u; random ^= random >> 17u; random ^= random << 5u; }
+        sink = random;
+    }
+
+    return sink;
+}
+
+// ... ->> Spinners run below normal priority, as background work would; The sweeper runs above it so its input is not what the load delays
+void Program::Load::start(char const arguments[]) {
+    SYSTEM_INFO   systemInformation;
+    unsigned long threads = 0uL;
+
+    ::GetSystemInfo(&systemInformation);
+    std::sscanf(arguments, "%lu", &threads);
+    if (0uL == threads || threads > systemInformation.dwNumberOfProcessors) threads = systemInformation.dwNumberOfProcessors;
+    if (threads > (sizeof(Program::Load::THREADS) / sizeof(::HANDLE)) - 1u) threads = (sizeof(Program::Load::THREADS) / sizeof(::HANDLE)) - 1u;
+
+    Program::Load::THREADS[0] = ::CreateThread(NULL, 0u, &Program::Load::sweep, NULL, 0x0u, NULL);
+    if (NULL == Program::Load::THREADS[0]) return;
+
+    ::SetThreadPriority(Program::Load::THREADS[0], THREAD_PRIORITY_ABOVE_NORMAL);
+    for (Program::Load::THREAD_COUNT = 1u; Program::Load::THREAD_COUNT != threads + 1u; ++Program::Load::THREAD_COUNT) {
+        Program::Load::THREADS[Program::Load::THREAD_COUNT] = ::CreateThread(NULL, 0u, &Program::Load::spin, NULL, 0x0u, NULL);
+        if (NULL == Program::Load::THREADS[Program::Load::THREAD_COUNT]) break;
+
+        ::SetThreadPriority(Program::Load::THREADS[Program::Load::THREAD_COUNT], THREAD_PRIORITY_BELOW_NORMAL);
+    }
+}
+
+// ... ->> Once `Simulation::RUNNING` is cleared; The latency histogram is the report
+void Program::Load::stop() {
+    if (0u == Program::Load::THREAD_COUNT) return;
+
+    ::WaitForMultipleObjects(Program::Load::THREAD_COUNT, Program::Load::THREADS, TRUE, INFINITE);
+    while (Program::Load::THREAD_COUNT) ::CloseHandle(Program::Load::THREADS[--Program::Load::THREAD_COUNT]);
+
+    Program::Profiler::save();
+}
+
+// ... ->> Back and forth along the board's diagonal, one tile per move, so every move changes the hovered tile & asks for a frame
+DWORD WINAPI Program::Load::sweep(LPVOID const) {
+    for (unsigned long step = 0uL; Program::Simulation::RUNNING; ++step) {
+        unsigned char const tile = step % (2u * Game::Tiles::COLUMN_COUNT) < Game::Tiles::COLUMN_COUNT ? step % Game::Tiles::COLUMN_COUNT : (Game::Tiles::COLUMN_COUNT - 1u) - (step % Game::Tiles::COLUMN_COUNT);
+
+        ::PostMessage(Window::HANDLE, WM_MOUSEMOVE, 0x0u, MAKELPARAM(Game::Board::LEFT + (tile * (Game::getTileWidth() + Game::Tiles::MARGIN)) + (Game::getTileWidth() / 2u), Game::Board::TOP + (tile * (Game::getTileHeight() + Game::Tiles::MARGIN)) + (Game::getTileHeight() / 2u)));
+        ::Sleep(Program::Load::SWEEP_INTERVAL);
+    }
+
+    return 0u;
+}
+
+// ... ->> Thread messages first, then `onsignal` if `signal` woke it, then every `ontick` due since; Returns `WM_QUIT`'s exit code, or `EXIT_SUCCESS` once `onsignal` returns false
+int Program::Loop::run(MSG& message, ::HANDLE const signal, bool (*const onsignal)(), DWORD const tick, void (*const ontick)()) {
+    DWORD const count = NULL != signal ? 1u : 0u;
+
+    for (DWORD due = ::GetTickCount() + tick; ; ) {
+        DWORD timeout = INFINITE;
+        DWORD woken;
+
+        if (0u != tick) {
+            LONG const remaining = static_cast<LONG>(due - ::GetTickCount());
+            timeout = remaining > 0 ? static_cast<DWORD>(remaining) : 0u;
+        }
+
+        woken = ::MsgWaitForMultipleObjects(count, &signal, FALSE, timeout, QS_ALLINPUT);
+        while (FALSE != ::PeekMessage(&message, NULL, 0x0u, 0x0u, PM_REMOVE)) {
+            if (WM_QUIT == message.message) return static_cast<int>(message.wParam);
+            ::DispatchMessage(&message);
+        }
+
+        if (0u != count && WAIT_OBJECT_0 == woken && false == (*onsignal)()) return EXIT_SUCCESS;
+        if (0u != tick) for (; static_cast<LONG>(::GetTickCount() - due) >= 0; due += tick) (*ontick)();
+    }
+}
+
+// ... ->> The calling thread's slot, claimed once
+Program::Metrics::Slot& Program::Metrics::acquire() {
+    LONG const index = ::InterlockedIncrement(&Program::Metrics::SLOTS_USED) - 1;
+
+    if (0 == Program::Metrics::FREQUENCY.QuadPart) ::QueryPerformanceFrequency(&Program::Metrics::FREQUENCY);
+    Program::Metrics::SLOT = Program::Metrics::SLOTS + (index < static_cast<LONG>(Program::Metrics::SLOT_COUNT) ? index : Program::Metrics::SLOT_COUNT - 1u);
+
+    return *Program::Metrics::SLOT;
+}
+
+// ... ->> A plain thread-local increment, for the hottest paths; Published by the next `flush()`
+void Program::Metrics::count(Program::Metrics::Counter const counter) {
+    ++Program::Metrics::PENDING[counter];
+}
+
+// ... ->> Adds the calling thread's pending counts to its slot
+void Program::Metrics::flush() {
+    Slot *const slot = NULL != Program::Metrics::SLOT ? Program::Metrics::SLOT : &Program::Metrics::acquire();
+
+    for (unsigned char counter = 0u; counter != Program::Metrics::COUNTER_COUNT; ++counter) {
+        slot -> counters[counter]         += Program::Metrics::PENDING[counter];
+        Program::Metrics::PENDING[counter] = 0u;
+    }
+}
+
+// ... ->> Every slot summed into `text` (at least 16 KiB: under 128 characters a line, 90 lines); Returns its length
+std::size_t Program::Metrics::format(char text[]) {
+    uint64_t    counters  [Program::Metrics::COUNTER_COUNT]                                     = {0u};
+    uint64_t    durations [Program::Metrics::LATENCY_COUNT]                                     = {0u};
+    uint64_t    histograms[Program::Metrics::LATENCY_COUNT][Program::Metrics::BUCKET_COUNT + 1u] = {{0u}};
+    std::size_t length                                                                          = 0u;
+    LONG const  used                                                                            = Program::Metrics::SLOTS_USED;
+
+    // ... ->> Read racily; Each count is a lone aligned word, so at worst a few increments behind
+    for (LONG index = used < static_cast<LONG>(Program::Metrics::SLOT_COUNT) ? used : Program::Metrics::SLOT_COUNT; index--; ) {
+        Slot const &slot = Program::Metrics::SLOTS[index];
+
+        for (unsigned char counter = 0u; counter != Program::Metrics::COUNTER_COUNT; ++counter) counters[counter] += slot.counters[counter];
+        for (unsigned char latency = 0u; latency != Program::Metrics::LATENCY_COUNT; ++latency) {
+            durations[latency] += slot.durations[latency];
+            for (unsigned char bucket = 0u; bucket <= Program::Metrics::BUCKET_COUNT; ++bucket) histograms[latency][bucket] += slot.histograms[latency][bucket];
+        }
+    }
+
+    for (unsigned char counter = 0u; counter != Program::Metrics::COUNTER_COUNT; ++counter)
+    length += std::sprintf(text + length, "# HELP %s %s.\n# TYPE %s counter\n%s %llu\n", Program::Metrics::NAMES[counter], Program::Metrics::HELP[counter], Program::Metrics::NAMES[counter], Program::Metrics::NAMES[counter], static_cast<unsigned long long>(counters[counter]));
+
+    // ... ->> Histogram buckets are cumulative
+    for (unsigned char latency = 0u; latency != Program::Metrics::LATENCY_COUNT; ++latency) {
+        uint64_t total = 0u;
+
+        length += std::sprintf(text + length, "# HELP %s %s.\n# TYPE %s histogram\n", Program::Metrics::LATENCY_NAMES[latency], Program::Metrics::LATENCY_HELP[latency], Program::Metrics::LATENCY_NAMES[latency]);
+        for (unsigned char bucket = 0u; bucket != Program::Metrics::BUCKET_COUNT; ++bucket)
+        length += std::sprintf(text + length, "%s_bucket{le=\"%.9f\"} %llu\n", Program::Metrics::LATENCY_NAMES[latency], static_cast<double>(1uL << (bucket + 6u)) / 1e9, static_cast<unsigned long long>(total += histograms[latency][bucket]));
+
+        total  += histograms[latency][Program::Metrics::BUCKET_COUNT];
+        length += std::sprintf(text + length, "%s_bucket{le=\"+Inf\"} %llu\n%s_sum %.9f\n%s_count %llu\n", Program::Metrics::LATENCY_NAMES[latency], static_cast<unsigned long long>(total), Program::Metrics::LATENCY_NAMES[latency], static_cast<double>(durations[latency]) / 1e9, Program::Metrics::LATENCY_NAMES[latency], static_cast<unsigned long long>(total));
+    }
+
+    return length;
+}
+
+// ... ->> Records a duration from the performance counter value `start` until now, as `weight` observations; Flushes pending counts too
+void Program::Metrics::observe(Program::Metrics::Latency const latency, LONGLONG const start, unsigned char const weight) {
+    unsigned char  bucket = 0u;
+    uint64_t       duration;
+    LARGE_INTEGER  end;
+    Slot *const    slot   = NULL != Program::Metrics::SLOT ? Program::Metrics::SLOT : &Program::Metrics::acquire();
+
+    ::QueryPerformanceCounter(&end);
+    duration = static_cast<uint64_t>(((end.QuadPart - start) * 1000000000LL) / Program::Metrics::FREQUENCY.QuadPart);
+
+    for (uint64_t value = duration >> 6u; 0u != value && bucket != Program::Metrics::BUCKET_COUNT; value >>= 1u) ++bucket;
+    slot -> histograms[latency][bucket] += weight;
+    slot -> durations[latency]          += duration * weight;
+    Program::Metrics::flush();
+}
+
+// ... ->> Answers each reader of `PIPE_NAME` with a fresh `format(...)`, one at a time
+DWORD WINAPI Program::Metrics::run(LPVOID const) {
+    static char text[16384];
+    ::HANDLE const pipe = ::CreateNamedPipe(Program::Metrics::PIPE_NAME, PIPE_ACCESS_OUTBOUND, PIPE_TYPE_BYTE | PIPE_WAIT | PIPE_REJECT_REMOTE_CLIENTS, 1u, sizeof(text), 0u, 0u, NULL);
+
+    if (Program::Metrics::INVALID_PIPE == pipe) return 1u; // ->> e.g.: Served by another process already
+    while (Program::Metrics::SERVING) {
+        DWORD written;
+
+        if (FALSE == ::ConnectNamedPipe(pipe, NULL) && ERROR_PIPE_CONNECTED != ::GetLastError()) { ::Sleep(100u); continue; }
+        if (Program::Metrics::SERVING) {
+            ::WriteFile(pipe, text, static_cast<DWORD>(Program::Metrics::format(text)), &written, NULL);
+            ::FlushFileBuffers(pipe);
+        }
+
+        ::DisconnectNamedPipe(pipe);
+    }
+
+    ::CloseHandle(pipe);
+    return 0u;
+}
+
+// ... ->> Whether the calling thread's current evaluation is the one in `SAMPLE_INTERVAL` to time
+bool Program::Metrics::sample() {
+    return 0u == ++Program::Metrics::SAMPLES % Program::Metrics::SAMPLE_INTERVAL;
+}
+
+bool Program::Metrics::start() {
+    Program::Metrics::SERVING = true;
+    Program::Metrics::THREAD  = ::CreateThread(NULL, 0u, &Program::Metrics::run, NULL, 0x0u, NULL);
+
+    if (NULL == Program::Metrics::THREAD) Program::Metrics::SERVING = false;
+    return NULL != Program::Metrics::THREAD;
+}
+
+// ... ->> `run(...)` is woken from `ConnectNamedPipe(...)` by connecting to it, retried until it exits
+void Program::Metrics::stop() {
+    if (NULL == Program::Metrics::THREAD) return;
+    Program::Metrics::SERVING = false;
+
+    do {
+        ::HANDLE const pipe = ::CreateFile(Program::Metrics::PIPE_NAME, GENERIC_READ, 0x0u, NULL, OPEN_EXISTING, 0x0u, NULL);
+        if (Program::Metrics::INVALID_PIPE != pipe) ::CloseHandle(pipe);
+    } while (WAIT_TIMEOUT == ::WaitForSingleObject(Program::Metrics::THREAD, 100u));
+
+    ::CloseHandle(Program::Metrics::THREAD);
+    Program::Metrics::THREAD = NULL;
+}
+
+void Program::Profiler::draw(HDC const deviceContextHandle) {
+    int y = 0;
+
+    // ... ->> Opaque so each line overwrites the last frame's instead of piling onto it
+    ::SetBkColor  (deviceContextHandle, 0x000000u);
+    ::SetBkMode   (deviceContextHandle, OPAQUE);
+    ::SetTextColor(deviceContextHandle, 0x00FFFFu);
+
+    for (unsigned char phase = 0u; phase != Program::Profiler::PHASE_COUNT; ++phase) {
+        char  text[96];
+        LONG  count = 0, median = 0, tail = 0;
+        int   length;
+
+        for (unsigned char bucket = 0u; bucket != Program::Profiler::BUCKET_COUNT; ++bucket)
+        count += Program::Profiler::HISTOGRAM[phase][bucket];
+
+        // ... ->> Upper bucket bounds of the 50th & 99th percentiles
+        for (LONG bucket = 0, cumulative = 0; bucket != Program::Profiler::BUCKET_COUNT; ++bucket) {
+            cumulative += Program::Profiler::HISTOGRAM[phase][bucket];
+
+            if (0 == median && cumulative * 2L   >= count && 0 != count) median = 1L << bucket;
+            if (0 == tail   && cumulative * 100L >= count * 99L && 0 != count) tail = 1L << bucket;
+        }
+
+        length = std::sprintf(text, "%-10s %8ld frames  p50 < %6ld us  p99 < %6ld us", Program::Profiler::NAMES[phase], count, median, tail);
+        ::TextOut(deviceContextHandle, 4, y += 16, text, length);
+    }
+}
+
+void Program::Profiler::record(unsigned char const phase, LONGLONG const start, LONGLONG const end) {
+    Program::Profiler::Sample *sample;
+    unsigned char              bucket   = 0u;
+    LONGLONG const             duration = ((end - start) * 1000000LL) / Program::Profiler::FREQUENCY.QuadPart;
+
+    for (LONGLONG value = duration; 0LL != value && bucket != Program::Profiler::BUCKET_COUNT - 1u; value >>= 1) ++bucket;
+    ::InterlockedIncrement(&Program::Profiler::HISTOGRAM[phase][bucket]);
+
+    sample = Program::Profiler::TRACE + (static_cast<unsigned long>(::InterlockedIncrement(&Program::Profiler::TRACE_COUNT) - 1) % Program::Profiler::TRACE_CAPACITY);
+    sample -> duration = duration;
+    sample -> phase    = phase;
+    sample -> start    = (start * 1000000LL) / Program::Profiler::FREQUENCY.QuadPart;
+}
+
+bool Program::Profiler::save() {
+    std::FILE *const   file  = std::fopen(Program::Profiler::FILE_NAME, "w");
+    unsigned long const count = static_cast<unsigned long>(Program::Profiler::TRACE_COUNT);
+
+    if (NULL == file) return false;
+
+    // ... ->> Histograms
+    std::fputs("{\"histograms\": {", file);
+    for (unsigned char phase = 0u; phase != Program::Profiler::PHASE_COUNT; ++phase) {
+        std::fprintf(file, "%s\"%s\": [", phase ? ", " : "", Program::Profiler::NAMES[phase]);
+
+        for (unsigned char bucket = 0u; bucket != Program::Profiler::BUCKET_COUNT; ++bucket)
+        std::fprintf(file, "%s%ld", bucket ? ", " : "", static_cast<long>(Program::Profiler::HISTOGRAM[phase][bucket]));
+
+        std::fputc(']', file);
+    }
+
+    // ... ->> Trace events (Chrome trace "complete" events, oldest first)
+    std::fputs("}, \"traceEvents\": [", file);
+    for (unsigned long index = count > Program::Profiler::TRACE_CAPACITY ? count - Program::Profiler::TRACE_CAPACITY : 0uL, first = index; index != count; ++index) {
+        Program::Profiler::Sample const *const sample = Program::Profiler::TRACE + (index % Program::Profiler::TRACE_CAPACITY);
+        std::fprintf(file, "%s{\"name\": \"%s\", \"ph\": \"X\", \"pid\": 0, \"tid\": 0, \"ts\": %lld, \"dur\": %lld}", first != index ? ", " : "", Program::Profiler::NAMES[sample -> phase], static_cast<long long>(sample -> start), static_cast<long long>(sample -> duration));
+    }
+
+    std::fputs("]}\n", file);
+    return 0 == std::fclose(file);
+}
+
+// ... ->> Only by the running instance, once it holds `Lock::MUTEX`; Readers find an empty ring until the first `publish()`
+bool Program::State::open() {
+    std::size_t const size = sizeof(Header) + (Program::State::CAPACITY * sizeof(Entry));
+
+    Program::State::MAPPING = ::CreateFileMapping(Program::State::PAGING_FILE, NULL, PAGE_READWRITE, 0u, static_cast<DWORD>(size), Program::State::MAPPING_NAME);
+    if (NULL != Program::State::MAPPING) Program::State::HEADER = static_cast<Header*>(::MapViewOfFile(Program::State::MAPPING, FILE_MAP_WRITE, 0u, 0u, size));
+    if (NULL == Program::State::HEADER) return false;
+
+    Program::State::ENTRIES            = reinterpret_cast<Entry*>(Program::State::HEADER + 1);
+    Program::State::HEADER -> capacity = Program::State::CAPACITY;
+    Program::State::HEADER -> size     = sizeof(Entry);
+    Program::State::HEADER -> version  = 0;
+    for (DWORD index = 0u; index != Program::State::CAPACITY; ++index) Program::State::ENTRIES[index].sequence = 0;
+
+    ::MemoryBarrier();
+    std::memcpy(Program::State::HEADER -> magic, Program::State::MAGIC, sizeof(Program::State::MAGIC)); // ->> Last, so readers never see a half-set header
+
+    return true;
+}
+
+// ... ->> Writes the next version over the oldest entry; A reader copying that entry meanwhile sees its `sequence` change & retries
+void Program::State::publish() {
+    LARGE_INTEGER counter;
+    Entry        *entry;
+    LONG          version;
+
+    if (NULL == Program::State::HEADER || Program::State::HASH == Game::CONTEXT -> hash) return;
+    version = Program::State::HEADER -> version + 1; // ->> The only writer
+    entry   = Program::State::ENTRIES + (static_cast<DWORD>(version) % Program::State::CAPACITY);
+
+    ::InterlockedExchange(&entry -> sequence, (version * 2) - 1);
+      for (unsigned char index = 0u; index != sizeof(entry -> memory); ++index) entry -> memory[index] = static_cast<unsigned char>(Game::CONTEXT -> memory[index]);
+      ::QueryPerformanceCounter(&counter);
+      entry -> counter = counter.QuadPart;
+    ::InterlockedExchange(&entry -> sequence, version * 2);
+    ::InterlockedExchange(&Program::State::HEADER -> version, version);
+
+    Program::State::HASH = Game::CONTEXT -> hash;
+}
+
+// ... ->> Copies `version` out of `entry`, unless it was overwritten before or during the copy
+bool Program::State::read(Program::State::Entry const& entry, LONG const version, unsigned char memory[], LONGLONG& counter) {
+    LONG const sequence = entry.sequence;
+
+    if (sequence != version * 2) return false;
+    ::MemoryBarrier();
+      std::memcpy(memory, entry.memory, sizeof(entry.memory));
+      counter = entry.counter;
+    ::MemoryBarrier();
+
+    return sequence == entry.sequence;
+}
+
+// ... ->> Sample reader: Prints every version published over `seconds` as it lands, then the publish-to-read latency & throughput seen
+int Program::State::watch(char const arguments[]) {
+    LARGE_INTEGER  end, frequency, now, start;
+    Header const  *header;
+    LONG           last    = 0;
+    double         latency = 0.0, slowest = 0.0; // ->> in microseconds
+    ::HANDLE const mapping = ::OpenFileMapping(FILE_MAP_READ, FALSE, Program::State::MAPPING_NAME);
+    unsigned long  missed  = 0uL, reads = 0uL, retries = 0uL;
+    unsigned       seconds = 10u;
+
+    std::sscanf(arguments, "%u", &seconds);
+    header = NULL != mapping ? static_cast<Header const*>(::MapViewOfFile(mapping, FILE_MAP_READ, 0u, 0u, 0u)) : NULL;
+
+    if (NULL == header || 0 != std::memcmp(header -> magic, Program::State::MAGIC, sizeof(Program::State::MAGIC)) || sizeof(Entry) != header -> size || 0u == header -> capacity) {
+        std::fprintf(stderr, "Unable to read \"%s\"; Is Chess running?\n", Program::State::MAPPING_NAME);
+        if (NULL != header) ::UnmapViewOfFile(header);
+        if (NULL != mapping) ::CloseHandle(mapping);
+
+        return EXIT_FAILURE;
+    }
+
+    ::QueryPerformanceFrequency(&frequency);
+    ::QueryPerformanceCounter(&start);
+    end.QuadPart = start.QuadPart + (seconds * frequency.QuadPart);
+    last         = header -> version;
+
+    for (now = start; now.QuadPart < end.QuadPart; ::QueryPerformanceCounter(&now)) {
+        LONG const version = header -> version;
+
+        if (version == last) { ::Sleep(0u); continue; }
+        if (version - last > static_cast<LONG>(header -> capacity)) { missed += static_cast<unsigned long>(version - last) - header -> capacity; last = version - static_cast<LONG>(header -> capacity); }
+
+        // ... ->> Oldest unread first; Straight out of the mapped view
+        for (LONG next = last + 1; next <= version; ++next) {
+            bool          copied;
+            LONGLONG      counter;
+            double        elapsed; // ->> in microseconds
+            unsigned char memory[35];
+            Entry const  &entry = reinterpret_cast<Entry const*>(header + 1)[static_cast<DWORD>(next) % header -> capacity];
+
+            while (false == (copied = Program::State::read(entry, next, memory, counter)) && entry.sequence - (next * 2) <= 0) ++retries;
+            if (false == copied) { ++missed; continue; } // ->> Overwritten by a later version first
+
+            ::QueryPerformanceCounter(&now);
+            elapsed  = static_cast<double>((now.QuadPart - counter) * 1000000LL) / frequency.QuadPart;
+            latency += elapsed;
+            slowest  = slowest > elapsed ? slowest : elapsed;
+            ++reads;
+
+            std::printf("%ld ", static_cast<long>(next));
+            for (unsigned char index = 0u; index != sizeof(memory); ++index) std::printf("%02X", memory[index]);
+            std::putchar('\n');
+        }
+
+        last = version;
+    }
+
+    std::printf("%lu versions read (%.1f/s), %lu missed, %lu retries; latency %.1fus mean, %.1fus max\n", reads, reads / (static_cast<double>(now.QuadPart - start.QuadPart) / frequency.QuadPart), missed, retries, 0uL != reads ? latency / reads : 0.0, slowest);
+    ::UnmapViewOfFile(header);
+    ::CloseHandle(mapping);
+
+    return EXIT_SUCCESS;
+}
+
+int Program::Swarm::compare(void const* const first, void const* const second) {
+    uint32_t const a = *static_cast<uint32_t const*>(first), b = *static_cast<uint32_t const*>(second);
+    return a < b ? -1 : a > b ? +1 : 0;
+}
+
+int Program::Swarm::main(char const arguments[]) {
+    std::size_t   count       = 0u;
+    unsigned      connections = Program::Swarm::CONNECTION_COUNT;
+    WSADATA       data;
+    unsigned      depth       = Program::Swarm::DEPTH;
+    LARGE_INTEGER end, start;
+    unsigned long games       = 10000uL;
+    unsigned      plies       = Program::Swarm::PLIES;
+    unsigned      port        = Program::Server::PORT;
+    ::HANDLE      threads[64];
+
+    std::sscanf(arguments, "%lu %u %u %u %u", &games, &connections, &plies, &depth, &port);
+    if (0uL == games || games > 0xFFFFFFFFuL || 0u == connections || connections > 64u || 0u == plies || plies > 0xFFFFu || 0u == depth || depth > Program::Server::DEPTH_LIMIT || 0u == port || port > 0xFFFFu) { std::fputs("usage: --swarm [games] [connections] [plies] [depth] [port]\n", stderr); return EXIT_FAILURE; }
+
+    Program::Server::PORT             = static_cast<unsigned short>(port);
+    Program::Swarm::CONNECTION_COUNT  = connections;
+    Program::Swarm::DEPTH             = static_cast<unsigned char>(depth);
+    Program::Swarm::PLIES             = static_cast<unsigned short>(plies);
+    Program::Swarm::TABLE_COUNT       = games;
+    Program::Swarm::LATENCIES         = static_cast<uint32_t*>(std::malloc(static_cast<std::size_t>(games) * plies * sizeof(uint32_t)));
+    Program::Swarm::TABLES            = static_cast<Table*>(std::calloc(games, sizeof(Table)));
+
+    if (NULL == Program::Swarm::LATENCIES || NULL == Program::Swarm::TABLES || false == Game::reserveContexts(games) || 0 != ::WSAStartup(MAKEWORD(2, 2), &data)) {
+        std::fprintf(stderr, "Unable to play %lu games\n", games);
+        std::free(Program::Swarm::LATENCIES);
+        std::free(Program::Swarm::TABLES);
+
+        return EXIT_FAILURE;
+    }
+
+    // ... ->> Every game's mirror starts from the initial position, as the server's does
+    for (std::size_t index = 0u; index != Program::Swarm::TABLE_COUNT; ++index) {
+        Table &table = Program::Swarm::TABLES[index];
+
+        table.context = Game::acquireContext();
+        table.random  = 0x9E3779B9u ^ (static_cast<uint32_t>(index) * 0x85EBCA6Bu) ^ ::GetTickCount();
+        Game::CONTEXT = table.context;
+        RESET();
+    }
+
+    Game::CONTEXT = &Game::DEFAULT;
+    ::QueryPerformanceFrequency(&Program::Swarm::FREQUENCY);
+    ::QueryPerformanceCounter(&start);
+
+    for (DWORD index = 0u; index != Program::Swarm::CONNECTION_COUNT; ++index) threads[index] = ::CreateThread(NULL, 0u, &Program::Swarm::run, reinterpret_cast<LPVOID>(static_cast<uintptr_t>(index)), 0x0u, NULL);
+    for (DWORD index = 0u; index != Program::Swarm::CONNECTION_COUNT; ++index) {
+        if (NULL == threads[index]) { ::InterlockedExchangeAdd(&Program::Swarm::FAILURES, static_cast<LONG>(((Program::Swarm::TABLE_COUNT * (index + 1u)) / Program::Swarm::CONNECTION_COUNT) - ((Program::Swarm::TABLE_COUNT * index) / Program::Swarm::CONNECTION_COUNT))); continue; }
+        ::WaitForSingleObject(threads[index], INFINITE);
+        ::CloseHandle(threads[index]);
+    }
+    ::QueryPerformanceCounter(&end);
+
+    // ... ->> Each table's answered moves, gathered to the front & sorted
+    for (std::size_t index = 0u; index != Program::Swarm::TABLE_COUNT; ++index)
+    for (unsigned short ply = 0u; ply != Program::Swarm::TABLES[index].plies; ++ply) Program::Swarm::LATENCIES[count++] = Program::Swarm::LATENCIES[(index * Program::Swarm::PLIES) + ply];
+
+    std::qsort(Program::Swarm::LATENCIES, count, sizeof(uint32_t), &Program::Swarm::compare);
+    if (0u == count) std::printf("%lu games over %u connections: No moves answered (%ld failed)\n", games, connections, static_cast<long>(Program::Swarm::FAILURES));
+    else {
+        double const seconds = static_cast<double>(end.QuadPart - start.QuadPart) / static_cast<double>(Program::Swarm::FREQUENCY.QuadPart);
+
+        std::printf("%lu games over %u connections: %lu moves in %.3fs, %.0f moves/s; Latency p50 %.3fms, p99 %.3fms, max %.3fms (%ld failed)\n",
+            games, connections, static_cast<unsigned long>(count), seconds, static_cast<double>(count) / seconds,
+            Program::Swarm::LATENCIES[count / 2u] / 1000.0, Program::Swarm::LATENCIES[(count * 99u) / 100u] / 1000.0, Program::Swarm::LATENCIES[count - 1u] / 1000.0,
+            static_cast<long>(Program::Swarm::FAILURES)
+        );
+    }
+
+    std::free(Program::Swarm::LATENCIES);
+    std::free(Program::Swarm::TABLES);
+    ::WSACleanup();
+
+    return 0 == Program::Swarm::FAILURES && 0u != count ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// ... ->> A random legal move for the mover of `table`, played on its mirror & written into `message`; None if it has none
+bool Program::Swarm::pick(Program::Swarm::Table& table, Program::Server::Message& message) {
+    unsigned char board[64];
+    bool          light;
+    unsigned      moves = 0u;
+
+    Game::CONTEXT = table.context;
+    light         = Player::LIGHT == Game::getTurn();
+    Game::getBoard(board);
+    for (unsigned char tile = 64u; tile--; )
+    if (0x00u != board[tile] && light == (0x00u != (board[tile] & 0x80u)))
+    for (uint64_t destinations = Game::getDestinations(tile); 0u != destinations; destinations &= destinations - 1u) ++moves;
+
+    if (0u == moves) return false;
+    table.random ^= table.random << 13u; table.random ^= table.random >> 17u; table.random ^= table.random << 5u;
+    moves = table.random % moves;
+
+    for (unsigned char tile = 64u; tile--; )
+    if (0x00u != board[tile] && light == (0x00u != (board[tile] & 0x80u)))
+    for (uint64_t destinations = Game::getDestinations(tile); 0u != destinations; destinations &= destinations - 1u)
+    if (0u == moves--) { message.from = tile; for (message.to = 0u; 0u == ((destinations >> message.to) & 0x01u); ) ++message.to; }
+
+    message.kind = Program::Server::MOVE;
+    message.code = Program::Swarm::DEPTH;
+    message.game = table.game;
+    message.tag  = static_cast<uint32_t>(&table - Program::Swarm::TABLES);
+
+    return Game::move(message.from, message.to);
+}
+
+// ... ->> One connection's share of the tables: All opened at once, then each answer is replied to with the next move; Every batch of replies goes out in one send
+DWORD WINAPI Program::Swarm::run(LPVOID const parameter) {
+    sockaddr_in       address   = sockaddr_in();
+    char              buffer[4096];
+    SOCKET const      client    = ::socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    BOOL const        delayless = TRUE;
+    DWORD const       index     = static_cast<DWORD>(reinterpret_cast<uintptr_t>(parameter));
+    std::size_t const first     = (Program::Swarm::TABLE_COUNT * index) / Program::Swarm::CONNECTION_COUNT;
+    std::size_t const last      = (Program::Swarm::TABLE_COUNT * (index + 1u)) / Program::Swarm::CONNECTION_COUNT;
+    std::size_t       length    = 0u;
+    std::size_t       open      = last - first;
+    int               received;
+    bool              sent      = false;
+    std::size_t const capacity  = open > sizeof(buffer) / sizeof(Program::Server::Message) ? open : sizeof(buffer) / sizeof(Program::Server::Message); // ->> Requests per send: Every `OPEN`, then at most one per reply
+    Program::Server::Message *const requests = static_cast<Program::Server::Message*>(std::malloc(capacity * sizeof(Program::Server::Message)));
+
+    address.sin_addr.s_addr = ::htonl(INADDR_LOOPBACK);
+    address.sin_family      = AF_INET;
+    address.sin_port        = ::htons(Program::Server::PORT);
+
+    if (NULL != requests && INVALID_SOCKET != client && SOCKET_ERROR != ::connect(client, reinterpret_cast<sockaddr const*>(&address), sizeof(address))) {
+        ::setsockopt(client, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<char const*>(&delayless), sizeof(delayless));
+
+        for (std::size_t table = first; table != last; ++table) {
+            Program::Server::Message const request = {Program::Server::OPEN, 0u, 0u, 0u, 0u, static_cast<uint32_t>(table)};
+            requests[table - first] = request;
+        }
+
+        sent = Program::Server::write(client, requests, open * sizeof(Program::Server::Message));
+    }
+
+    while (sent && 0u != open && 0 < (received = ::recv(client, buffer + length, static_cast<int>(sizeof(buffer) - length), 0))) {
+        std::size_t   count  = 0u;
+        LARGE_INTEGER now;
+        std::size_t   offset = 0u;
+
+        ::QueryPerformanceCounter(&now);
+        for (length += static_cast<std::size_t>(received); length - offset >= sizeof(Program::Server::Message); offset += sizeof(Program::Server::Message)) {
+            Program::Server::Message message;
+            Table                   *table;
+
+            std::memcpy(&message, buffer + offset, sizeof(Program::Server::Message));
+            table = Program::Swarm::TABLES + message.tag;
+
+            switch (message.kind) {
+                case Program::Server::CLOSE:
+                    if (Program::Server::OK != message.code) ::InterlockedIncrement(&Program::Swarm::FAILURES);
+                    --open;
+                    continue;
+
+                case Program::Server::MOVE:
+                    Program::Swarm::LATENCIES[(message.tag * static_cast<std::size_t>(Program::Swarm::PLIES)) + table -> plies++] = static_cast<uint32_t>(((now.QuadPart - table -> sent) * 1000000LL) / Program::Swarm::FREQUENCY.QuadPart);
+                    Game::CONTEXT = table -> context;
+
+                    if (Program::Server::OK == message.code) { if (Game::move(message.from, message.to) && table -> plies != Program::Swarm::PLIES && Program::Swarm::pick(*table, requests[count])) { ++count; continue; } }
+                    else if (Program::Server::OVER != message.code) ::InterlockedIncrement(&Program::Swarm::FAILURES);
+                    break;
+
+                case Program::Server::OPEN:
+                    if (Program::Server::OK != message.code) { ::InterlockedIncrement(&Program::Swarm::FAILURES); --open; continue; }
+                    table -> game = message.game;
+                    if (Program::Swarm::pick(*table, requests[count])) { ++count; continue; }
+                    break;
+            }
+
+            // ... ->> Over, or cut short
+            message.kind      = Program::Server::CLOSE;
+            message.code      = 0u;
+            requests[count++] = message;
+        }
+
+        std::memmove(buffer, buffer + offset, length - offset);
+        length -= offset;
+
+        // ... ->> Every move of the batch is timed from the send carrying it
+        ::QueryPerformanceCounter(&now);
+        for (std::size_t request = 0u; request != count; ++request) if (Program::Server::MOVE == requests[request].kind) Program::Swarm::TABLES[requests[request].tag].sent = now.QuadPart;
+        sent = 0u == count || Program::Server::write(client, requests, count * sizeof(Program::Server::Message));
+    }
+
+    ::InterlockedExchangeAdd(&Program::Swarm::FAILURES, static_cast<LONG>(open)); // ->> Never answered
+    if (INVALID_SOCKET != client) ::closesocket(client);
+    std::free(requests);
+    Game::CONTEXT = &Game::DEFAULT;
+
+    return 0u;
+}
+
+int Program::Tournament::main(char const arguments[]) {
+    double const  lower           = std::log(Program::Tournament::BETA / (1.0 - Program::Tournament::ALPHA));
+    double const  upper           = std::log((1.0 - Program::Tournament::BETA) / Program::Tournament::ALPHA);
+    char          engines[2][8]   = {"network", "linear"};
+    std::FILE    *file            = NULL;
+    char          line[512];
+    char          path[MAX_PATH]  = {'\0'};
+    LONG          reported        = -1;
+    char const   *status          = "running";
+    SYSTEM_INFO   systemInformation;
+    ::HANDLE      threads[64];
+    DWORD         threadCount;
+
+    ::GetSystemInfo(&systemInformation);
+    Program::Tournament::GAMES = 1000;
+
+    if (std::sscanf(arguments, "%259s %ld %lu %lu %7s %7s", path, &Program::Tournament::GAMES, &Program::Tournament::TIME, &Program::Tournament::INCREMENT, engines[0], engines[1]) < 1 || Program::Tournament::GAMES <= 0) { std::fputs("usage: --tournament openings [games] [milliseconds] [increment] [first] [second]\n", stderr); return EXIT_FAILURE; }
+    for (unsigned char engine = 0u; engine != 2u; ++engine) {
+        if (0 != std::strcmp(engines[engine], "linear") && 0 != std::strcmp(engines[engine], "network")) { std::fprintf(stderr, "Unknown engine \"%s\"; Expected `linear` or `network`\n", engines[engine]); return EXIT_FAILURE; }
+        Program::Tournament::ENGINES[engine] = 0 == std::strcmp(engines[engine], "network");
+    }
+
+    Game::Network::FILE_NAME = "ChessNetwork.nnue";
+    if ((Program::Tournament::ENGINES[0] || Program::Tournament::ENGINES[1]) && false == Game::Network::load()) { std::fprintf(stderr, "Unable to load \"%s\" for the `network` engine\n", Game::Network::FILE_NAME); return EXIT_FAILURE; }
+
+    // ... ->> One opening per line, as moves from & to tiles, e.g.: `d2d4 e7e5`; Illegal ones are skipped
+    file = std::fopen(path, "r");
+    while (NULL != file && NULL != std::fgets(line, sizeof(line), file)) {
+        Game::Context  context = Game::Context();
+        char           move[4];
+        Opening       *openings;
+        Opening        opening = Opening();
+        char const    *text    = line;
+
+        Game::CONTEXT = &context;
+        RESET();
+
+        for (int length = 0; opening.count != Program::Tournament::OPENING_LIMIT && 4 == std::sscanf(text, " %c%c%c%c%n", move + 0, move + 1, move + 2, move + 3, &length); text += length) {
+            if (move[0] < 'a' || move[0] > 'h' || move[1] < '1' || move[1] > '8' || move[2] < 'a' || move[2] > 'h' || move[3] < '1' || move[3] > '8') { opening.count = 0u; break; }
+            opening.moves[opening.count][0] = static_cast<unsigned char>((move[0] - 'a') + ((move[1] - '1') * Game::Tiles::COLUMN_COUNT));
+            opening.moves[opening.count][1] = static_cast<unsigned char>((move[2] - 'a') + ((move[3] - '1') * Game::Tiles::COLUMN_COUNT));
+
+            if (0u == ((Game::getDestinations(opening.moves[opening.count][0]) >> opening.moves[opening.count][1]) & 0x01u)) { opening.count = 0u; break; }
+            Game::move(opening.moves[opening.count][0], opening.moves[opening.count][1]);
+            ++opening.count;
+        }
+
+        Game::CONTEXT = &Game::DEFAULT;
+        if (0u == opening.count) continue;
+
+        openings = static_cast<Opening*>(std::realloc(Program::Tournament::OPENINGS, (Program::Tournament::OPENING_COUNT + 1u) * sizeof(Opening)));
+        if (NULL == openings) break;
+
+        Program::Tournament::OPENINGS                                      = openings;
+        Program::Tournament::OPENINGS[Program::Tournament::OPENING_COUNT++] = opening;
+    }
+
+    if (NULL != file) std::fclose(file);
+    Program::Tournament::SIGNAL = ::CreateEvent(NULL, FALSE, FALSE, NULL);
+
+    if (0u == Program::Tournament::OPENING_COUNT || NULL == Program::Tournament::SIGNAL) {
+        std::fprintf(stderr, "Unable to read openings from \"%s\"\n", path);
+        if (NULL != Program::Tournament::SIGNAL) ::CloseHandle(Program::Tournament::SIGNAL);
+        std::free(Program::Tournament::OPENINGS);
+        std::free(Game::Network::FEATURE_WEIGHTS);
+
+        return EXIT_FAILURE;
+    }
+
+    // ... ->> No more workers than games
+    threadCount                  = systemInformation.dwNumberOfProcessors < 64u ? (systemInformation.dwNumberOfProcessors > 1u ? systemInformation.dwNumberOfProcessors : 1u) : 64u;
+    threadCount                  = static_cast<DWORD>(Program::Tournament::GAMES) < threadCount ? static_cast<DWORD>(Program::Tournament::GAMES) : threadCount;
+    Program::Tournament::RUNNING = static_cast<LONG>(threadCount);
+    Program::Metrics::start();
+
+    for (DWORD index = 0u; index != threadCount; ++index) {
+        threads[index] = ::CreateThread(NULL, 0u, &Program::Tournament::run, NULL, 0x0u, NULL);
+        if (NULL == threads[index]) ::InterlockedDecrement(&Program::Tournament::RUNNING);
+    }
+
+    if (0 == Program::Tournament::RUNNING) { Program::Tournament::RUNNING = 1; Program::Tournament::run(NULL); }
+
+    // ... ->> Re-tested after every finished game
+    for (bool running = true; running; ) {
+        LONG   draws, losses, wins, games;
+        double llr = 0.0, score, variance;
+
+        running = 0 != Program::Tournament::RUNNING;
+        if (running) ::WaitForSingleObject(Program::Tournament::SIGNAL, 1000u);
+
+        losses = Program::Tournament::RESULTS[0];
+        draws  = Program::Tournament::RESULTS[1];
+        wins   = Program::Tournament::RESULTS[2];
+        games  = losses + draws + wins;
+        if (games == reported && (running || Program::Tournament::STOPPED)) continue; // ->> A decided test was already reported
+
+        // ... ->> Log-likelihood ratio of the alternative to the null hypothesis, under a normal approximation of the mean score
+        score    = 0 != games ? (wins + (draws * 0.5)) / games : 0.5;
+        variance = 0 != games ? ((wins * (1.0 - score) * (1.0 - score)) + (draws * (0.5 - score) * (0.5 - score)) + (losses * score * score)) / games : 0.0;
+
+        if (variance > 0.0) {
+            double const expected[2] = {1.0 / (1.0 + std::pow(10.0, -Program::Tournament::ELO0 / 400.0)), 1.0 / (1.0 + std::pow(10.0, -Program::Tournament::ELO1 / 400.0))};
+            llr = (games * (expected[1] - expected[0]) * ((2.0 * score) - expected[0] - expected[1])) / (2.0 * variance);
+        }
+
+        if      (llr >= upper) { status = "accepted"; Program::Tournament::STOPPED = true; }
+        else if (llr <= lower) { status = "rejected"; Program::Tournament::STOPPED = true; }
+        else if (false == running) status = "inconclusive";
+
+        score    = score < 0.001 ? 0.001 : score > 0.999 ? 0.999 : score;
+        reported = games;
+
+        std::printf("{\"games\": %ld, \"wins\": %ld, \"draws\": %ld, \"losses\": %ld, \"forfeits\": %ld, \"elo\": %.1f, \"llr\": %.3f, \"lower\": %.3f, \"upper\": %.3f, \"status\": \"%s\"}\n", games, wins, draws, losses, static_cast<LONG>(Program::Tournament::FORFEITS), -400.0 * std::log10((1.0 / score) - 1.0), llr, lower, upper, running && false == Program::Tournament::STOPPED ? "running" : status);
+        std::fflush(stdout);
+    }
+
+    for (DWORD index = 0u; index != threadCount; ++index)
+    if (NULL != threads[index]) { ::WaitForSingleObject(threads[index], INFINITE); ::CloseHandle(threads[index]); }
+
+    Program::Metrics::stop();
+    ::CloseHandle(Program::Tournament::SIGNAL);
+    std::free(Program::Tournament::OPENINGS);
+    std::free(Game::Network::FEATURE_WEIGHTS);
+
+    return EXIT_SUCCESS;
+}
+
+// ... ->> One game from `opening`, the first engine playing dark if `swapped`; Result is 0, 1 or 2 for a dark win, draw or light win, or `0xFF` if abandoned
+unsigned char Program::Tournament::play(Program::Tournament::Opening const& opening, bool const swapped) {
+    unsigned char drawn = 0u, won = 0u;
+    LARGE_INTEGER frequency;
+    uint64_t      hashes[Program::Tournament::OPENING_LIMIT + Program::Tournament::PLY_LIMIT];
+    int           previous = 0;
+
+    ::QueryPerformanceFrequency(&frequency);
+    RESET();
+    Game::CONTEXT -> clock[0] = Game::CONTEXT -> clock[1] = Program::Tournament::TIME;
+
+    for (unsigned char index = 0u; index != opening.count; ++index) {
+        hashes[index] = Game::CONTEXT -> hash;
+        Game::move(opening.moves[index][0], opening.moves[index][1]);
+    }
+
+    for (unsigned short ply = opening.count; ply != opening.count + Program::Tournament::PLY_LIMIT; ++ply) {
+        unsigned char board[64];
+        bool          checked = false;
+        LARGE_INTEGER end, start;
+        DWORD         elapsed;
+        unsigned char line[4] = {Game::Replay::MOVELESS, Game::Replay::MOVELESS, Game::Replay::MOVELESS, Game::Replay::MOVELESS};
+        bool const    light   = Player::LIGHT == Game::getTurn();
+        unsigned char minors  = 0u, others = 0u, repetitions = 0u;
+        DWORD const   budget  = (Game::CONTEXT -> clock[light] / 20u) + (Program::Tournament::INCREMENT / 2u); // ->> of the mover's clock
+        int           score   = 0;
+
+        if (Program::Tournament::STOPPED) return 0xFFu;
+
+        // ... ->> Drawn by repetition (thrice) or by insufficient material (at most one knight or bishop)
+        hashes[ply] = Game::CONTEXT -> hash;
+        for (unsigned short index = ply; index--; ) repetitions += hashes[index] == hashes[ply];
+        if (repetitions >= 2u) return 1u;
+
+        Game::getBoard(board);
+        for (unsigned char tile = 64u; tile--; )
+        switch (board[tile] & 0x7Fu) {
+            case 0x00u: break;
+            case Piece::BISHOP + 1u: case Piece::KNIGHT + 1u: ++minors; break;
+            case Piece::KING   + 1u: if ((0x00u != (board[tile] & 0x80u)) == light) checked = Game::isAttacked(board, tile, false == light); break;
+            default: ++others;
+        }
+
+        if (0u == others && minors <= 1u) return 1u;
+
+        // ... ->> Searched on the mover's time, measured on the performance counter
+        ::QueryPerformanceCounter(&start);
+        Program::Analysis::CANCELLED = false;
+        Program::Analysis::COMPLETED = 0u;
+        Program::Analysis::NETWORK   = Program::Tournament::ENGINES[light == swapped ? 1 : 0];
+        Program::Analysis::NODES     = 0uL;
+        Program::Analysis::STOP      = start.QuadPart + ((budget < Game::CONTEXT -> clock[light] ? budget : Game::CONTEXT -> clock[light]) * frequency.QuadPart) / 1000;
+        if (Game::Network::LOADED && Program::Analysis::NETWORK) Game::Network::refresh(); // ->> Once, rather than at every leaf
+
+        for (unsigned char depth = 1u; depth <= Program::Tournament::DEPTH_LIMIT; ++depth) {
+            unsigned char best[4] = {line[0], line[1], Game::Replay::MOVELESS, Game::Replay::MOVELESS};
+            int const     value   = Program::Analysis::search(depth, 0u, -Program::Analysis::MATE - 1, +Program::Analysis::MATE + 1, best);
+
+            if (Program::Analysis::CANCELLED) break;
+            Program::Analysis::COMPLETED = depth;
+            line[0] = best[0]; line[1] = best[1];
+            score   = value;
+
+            ::QueryPerformanceCounter(&end);
+            if (value >= Program::Analysis::MATE - Program::Tournament::PLY_LIMIT || value <= Program::Tournament::PLY_LIMIT - Program::Analysis::MATE || 2 * (end.QuadPart - start.QuadPart) >= Program::Analysis::STOP - start.QuadPart) break; // ->> Mate found, or too little time left for another depth
+        }
+
+        ::QueryPerformanceCounter(&end);
+        elapsed = static_cast<DWORD>(((end.QuadPart - start.QuadPart) * 1000) / frequency.QuadPart);
+
+        if (Game::Replay::MOVELESS == line[0]) return checked ? (light ? 0u : 2u) : 1u; // ->> Mated, or stalemated
+        if (elapsed > Game::CONTEXT -> clock[light]) { ::InterlockedIncrement(&Program::Tournament::FORFEITS); return light ? 0u : 2u; }
+        Game::CONTEXT -> clock[light] += Program::Tournament::INCREMENT - elapsed;
+
+        // ... ->> Adjudicated once the scores, for light, agree long enough
+        score = light ? score : -score;
+        won   = (score >= +Program::Tournament::WON && previous >= +Program::Tournament::WON) || (score <= -Program::Tournament::WON && previous <= -Program::Tournament::WON) ? won + 1u : 0u;
+        drawn = ply >= Program::Tournament::DRAWN_PLY && score <= +Program::Tournament::DRAWN && score >= -Program::Tournament::DRAWN ? drawn + 1u : 0u;
+
+        if (won   >= Program::Tournament::WON_PLIES  ) return score > 0 ? 2u : 0u;
+        if (drawn >= Program::Tournament::DRAWN_PLIES) return 1u;
+
+        previous = score;
+        Game::move(line[0], line[1]);
+    }
+
+    return 1u;
+}
+
+// ... ->> Plays games until they run out or the test decides
+DWORD WINAPI Program::Tournament::run(LPVOID const) {
+    Game::Context context = Game::Context();
+    LONG          game;
+
+    Game::CONTEXT = &context;
+
+    while (false == Program::Tournament::STOPPED && (game = ::InterlockedIncrement(&Program::Tournament::NEXT) - 1) < Program::Tournament::GAMES) {
+        bool const          swapped = 0 != (game & 1);
+        unsigned char const result  = Program::Tournament::play(Program::Tournament::OPENINGS[(static_cast<std::size_t>(game) / 2u) % Program::Tournament::OPENING_COUNT], swapped);
+
+        if (0xFFu == result) break;
+        ::InterlockedIncrement(Program::Tournament::RESULTS + (swapped ? 2u - result : result));
+        ::SetEvent(Program::Tournament::SIGNAL);
+    }
+
+    Game::CONTEXT = &Game::DEFAULT;
+    ::InterlockedDecrement(&Program::Tournament::RUNNING);
+    ::SetEvent(Program::Tournament::SIGNAL);
+
+    return 0u;
+}
+
+// ... ->> Reads the records of the corpus at `path` whole into one allocation, or none; Sized with 64-bit offsets as `long` (`std::ftell(...)`) is 32-bit on Windows
+unsigned char* Program::Tuner::load(char const path[], std::size_t& count) {
+    unsigned char   *corpus = NULL;
+    std::FILE *const file   = std::fopen(path, "rb");
+    char             magic[sizeof(Program::Generator::MAGIC)];
+    LONGLONG         size   = 0;
+
+    count = 0u;
+    if (NULL == file) return NULL;
+
+    // ... ->> Headerless (or other-versioned) corpora are refused rather than misread
+    if (1u != std::fread(magic, sizeof(magic), 1u, file) || 0 != std::memcmp(magic, Program::Generator::MAGIC, sizeof(magic)))
+    std::fprintf(stderr, "\"%s\" is not a %.4s corpus; Regenerate it, or migrate it as `model.txt` describes\n", path, Program::Generator::MAGIC);
+
+    else if (0 == ::_fseeki64(file, 0, SEEK_END) && (size = ::_ftelli64(file) - static_cast<LONGLONG>(sizeof(magic))) > 0 && static_cast<ULONGLONG>(size) / Program::Tuner::RECORD_SIZE <= static_cast<std::size_t>(-1) / Program::Tuner::RECORD_SIZE) {
+        count  = static_cast<std::size_t>(size / Program::Tuner::RECORD_SIZE);
+        corpus = static_cast<unsigned char*>(std::malloc(count * Program::Tuner::RECORD_SIZE));
+
+        if (NULL == corpus || 0 != ::_fseeki64(file, sizeof(magic), SEEK_SET) || count != std::fread(corpus, Program::Tuner::RECORD_SIZE, count, file)) { std::free(corpus); corpus = NULL; count = 0u; }
+    }
+
+    std::fclose(file);
+    return corpus;
+}
+
+int Program::Tuner::main(char const arguments[]) {
+    double        adam[2][Game::Evaluation::FEATURE_COUNT] = {{0.0}}; // ->> First & second moment estimates
+    double        rate                                     = 1.0;
+    std::size_t   count                                    = 0u;
+    LARGE_INTEGER frequency;
+    char          path[MAX_PATH]                           = {'\0'};
+    SYSTEM_INFO   systemInformation;
+    ::HANDLE      threads[64];
+    DWORD         threadCount;
+    unsigned      epochs                                   = 100u;
+    Work         *works                                    = NULL;
+
+    ::GetSystemInfo(&systemInformation);
+    ::QueryPerformanceFrequency(&frequency);
+    threadCount = systemInformation.dwNumberOfProcessors < 64u ? (systemInformation.dwNumberOfProcessors > 1u ? systemInformation.dwNumberOfProcessors : 1u) : 64u;
+
+    if (std::sscanf(arguments, "%259s %u %lf", path, &epochs, &rate) < 1) { std::fputs("usage: --tune corpus [epochs] [rate]\n", stderr); return EXIT_FAILURE; }
+
+    // ... ->> Corpus is read whole, once
+    Program::Tuner::CORPUS = Program::Tuner::load(path, count);
+
+    Program::Tuner::BOARDS = static_cast<unsigned char*>(std::malloc(count * 32u));
+    works                  = static_cast<Work*>(std::calloc(threadCount, sizeof(Work)));
+
+    if (0u == count || NULL == Program::Tuner::BOARDS || NULL == Program::Tuner::CORPUS || NULL == works) std::fprintf(stderr, "Unable to tune on \"%s\"\n", path);
+    else for (unsigned epoch = 0u; epoch <= epochs; ++epoch) {
+        LARGE_INTEGER end, start;
+        double        loss = 0.0;
+
+        // ... ->> Epoch zero only decodes the corpus into `BOARDS`
+        ::QueryPerformanceCounter(&start);
+        for (DWORD index = 0u; index != threadCount; ++index) {
+            works[index].decoding = 0u == epoch;
+            works[index].first    = (count * index)      / threadCount;
+            works[index].last     = (count * (index + 1u)) / threadCount;
+            threads[index]        = ::CreateThread(NULL, 0u, &Program::Tuner::run, works + index, 0x0u, NULL);
+
+            if (NULL == threads[index]) Program::Tuner::run(works + index);
+        }
+
+        for (DWORD index = 0u; index != threadCount; ++index)
+        if (NULL != threads[index]) { ::WaitForSingleObject(threads[index], INFINITE); ::CloseHandle(threads[index]); }
+
+        // ... ->> Reduce, then one Adam step
+        if (0u != epoch) for (unsigned short feature = 0u; feature != Game::Evaluation::FEATURE_COUNT; ++feature) {
+            double gradient = 0.0;
+
+            for (DWORD index = 0u; index != threadCount; ++index) gradient += works[index].gradient[feature];
+            gradient /= count;
+
+            adam[0][feature] = (0.9   * adam[0][feature]) + (0.1   * gradient);
+            adam[1][feature] = (0.999 * adam[1][feature]) + (0.001 * gradient * gradient);
+            Game::Evaluation::WEIGHTS[feature] -= static_cast<float>(rate * (adam[0][feature] / (1.0 - std::pow(0.9, static_cast<double>(epoch)))) / (std::sqrt(adam[1][feature] / (1.0 - std::pow(0.999, static_cast<double>(epoch)))) + 1e-8));
+        }
+
+        ::QueryPerformanceCounter(&end);
+        for (DWORD index = 0u; index != threadCount; ++index) loss += works[index].loss;
+
+        if (0u == epoch) std::printf("decoded %lu positions on %lu threads in %.3fs\n", static_cast<unsigned long>(count), static_cast<unsigned long>(threadCount), static_cast<double>(end.QuadPart - start.QuadPart) / frequency.QuadPart);
+        else std::printf("epoch %u: loss %.6f, %.3fs, %.0f positions/s\n", epoch, loss / count, static_cast<double>(end.QuadPart - start.QuadPart) / frequency.QuadPart, count / (static_cast<double>(end.QuadPart - start.QuadPart) / frequency.QuadPart));
+    }
+
+    // ... ->> Tuned weights, as an initializer for `Game::Evaluation::WEIGHTS`
+    if (NULL != works)
+    for (unsigned short feature = 0u; feature != Game::Evaluation::FEATURE_COUNT; ++feature)
+    std::printf("%.1ff%s", Game::Evaluation::WEIGHTS[feature], feature + 1u == Game::Evaluation::FEATURE_COUNT ? "\n" : 5u == feature % 6u ? ",\n" : ", ");
+
+    std::free(works);
+    std::free(Program::Tuner::BOARDS);
+    std::free(Program::Tuner::CORPUS);
+
+    return NULL != works && 0u != count ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+DWORD WINAPI Program::Tuner::run(LPVOID const parameter) {
+    Work *const   work = static_cast<Work*>(parameter);
+    unsigned char board[64];
+
+    if (work -> decoding) {
+        Game::Context context = Game::Context();
+        Game::CONTEXT = &context; // ->> This thread's alone
+
+        for (std::size_t position = work -> first; position != work -> last; ++position) {
+            for (unsigned char index = 35u; index--; ) context.memory[index] = Program::Tuner::CORPUS[(position * Program::Tuner::RECORD_SIZE) + index];
+            Game::getBoard(board);
+
+            for (unsigned char tile = 0u; tile != 64u; tile += 2u)
+            Program::Tuner::BOARDS[(position * 32u) + (tile / 2u)] = (((board[tile] & 0x07u) | ((board[tile] & 0x80u) >> 4u)) << 0u) | (((board[tile + 1u] & 0x07u) | ((board[tile + 1u] & 0x80u) >> 4u)) << 4u);
+        }
+
+        Game::CONTEXT = &Game::DEFAULT;
+        return 0u;
+    }
+
+    for (unsigned short feature = Game::Evaluation::FEATURE_COUNT; feature--; ) work -> gradient[feature] = 0.0;
+    work -> loss = 0.0;
+
+    for (std::size_t position = work -> first; position != work -> last; ++position) {
+        unsigned short indices[Game::Evaluation::FEATURE_LIMIT];
+        double const   result = Program::Tuner::CORPUS[(position * Program::Tuner::RECORD_SIZE) + 37u] / 2.0;
+        double         score  = 0.0;
+        unsigned char  count;
+        double         error, prediction;
+        signed char    values[Game::Evaluation::FEATURE_LIMIT];
+
+        for (unsigned char tile = 0u; tile != 64u; ++tile) {
+            unsigned char const nibble = (Program::Tuner::BOARDS[(position * 32u) + (tile / 2u)] >> ((tile % 2u) * 4u)) & 0x0Fu;
+            board[tile] = (nibble & 0x07u) | ((nibble & 0x08u) << 4u);
+        }
+
+        count = Game::getFeatures(board, indices, values);
+        for (unsigned char index = count; index--; ) score += Game::Evaluation::WEIGHTS[indices[index]] * values[index];
+
+        // ... ->> Cross-entropy of the predicted light score; Its gradient by `score` is just `error × SCALE`
+        prediction    = 1.0 / (1.0 + std::exp(-score * Program::Tuner::SCALE));
+        error         = prediction - result;
+        work -> loss -= (result * std::log(prediction > 1e-12 ? prediction : 1e-12)) + ((1.0 - result) * std::log(1.0 - prediction > 1e-12 ? 1.0 - prediction : 1e-12));
+
+        for (unsigned char index = count; index--; ) work -> gradient[indices[index]] += error * Program::Tuner::SCALE * values[index];
+    }
+
+    return 0u;
+}
+
+DWORD WINAPI Program::Render::run(LPVOID const) {
+    Game::CONTEXT = &Program::Render::FRAME.context;
+
+    while (WAIT_OBJECT_0 == ::WaitForSingleObject(Program::Render::SIGNAL, INFINITE) && Program::Simulation::RUNNING) {
+        // ... ->> Only the snapshot is taken under the lock, so input is never held up behind a frame
+        ::EnterCriticalSection(&Program::Simulation::STATE);
+          Program::Render::INPUT_TIME[Program::Render::BACK] = Program::Render::PENDING_TIME;
+          Program::Render::PENDING_TIME                      = 0;
+
+          std::memcpy(Program::Render::FRAME.context.memory, Game::DEFAULT.memory, sizeof(Game::DEFAULT.memory));
+          Program::Render::FRAME.context.hash = Game::DEFAULT.hash;
+          Program::Render::FRAME.hover        = Game::Tiles::HOVER;
+          Program::Render::FRAME.hovered      = Game::Tiles::HOVERED;
+          Program::Render::FRAME.select       = Game::Tiles::SELECT;
+          Program::Render::FRAME.selected     = Game::Tiles::SELECTED;
+        ::LeaveCriticalSection(&Program::Simulation::STATE);
+
+        RENDER();
+        Program::Metrics::flush();
+
+        // ... ->> Publish the finished frame and take back whichever one it replaces
+        Program::Render::BACK = ::InterlockedExchange(&Program::Render::READY, Program::Render::BACK | Program::Render::FRESH) & ~Program::Render::FRESH;
+        ::InvalidateRect(Window::HANDLE, NULL, FALSE);
+    }
+
+    return 0u;
+}
+
+// ... ->> Plays a queued `MOVE` on the calling worker, then the engine's answer to it
+void Program::Server::answer(Program::Server::Task const& task) {
+    unsigned char line[4] = {Game::Replay::MOVELESS, Game::Replay::MOVELESS, Game::Replay::MOVELESS, Game::Replay::MOVELESS};
+    Message       message = task.message;
+
+    Game::CONTEXT = Game::Contexts::MEMORY + message.game;
+    if (message.from < 64u && message.to < 64u && 0u != ((Game::getDestinations(message.from) >> message.to) & 0x01u) && Game::move(message.from, message.to)) {
+        Program::Analysis::CANCELLED = false;
+        Program::Analysis::COMPLETED = 0u;
+        Program::Analysis::NODES     = 0uL;
+        if (Game::Network::LOADED && 0x03u != Game::CONTEXT -> accumulated) Game::Network::refresh(); // ->> Once, rather than at every leaf
+
+        Program::Analysis::search(message.code < 1u ? 1u : message.code < Program::Server::DEPTH_LIMIT ? message.code : Program::Server::DEPTH_LIMIT, 0u, -Program::Analysis::MATE - 1, +Program::Analysis::MATE + 1, line);
+        message.code = Game::Replay::MOVELESS != line[0] && Game::move(line[0], line[1]) ? Program::Server::OK : Program::Server::OVER;
+        message.from = line[0];
+        message.to   = line[1];
+    }
+
+    else message.code = Program::Server::ILLEGAL;
+
+    Game::CONTEXT = &Game::DEFAULT;
+    ::InterlockedExchange(Program::Server::STATES + message.game, 1); // ->> Before the reply, which the client may answer at once
+    Program::Server::reply(*task.connection, &message, sizeof(Message));
+    ::InterlockedDecrement(&task.connection -> pending);
+}
+
+int Program::Server::main(char const arguments[]) {
+    WSADATA            data;
+    unsigned long      games     = 10000uL;
+    SOCKET             listener  = INVALID_SOCKET;
+    unsigned           port      = Program::Server::PORT;
+    sockaddr_in        address   = sockaddr_in();
+    bool               listening = false;
+    SYSTEM_INFO        systemInformation;
+    unsigned long      workers   = 0uL;
+
+    ::GetSystemInfo(&systemInformation);
+    std::sscanf(arguments, "%lu %u %lu", &games, &port, &workers);
+    if (0uL == games || games > 0xFFFFFFFFuL || 0u == port || port > 0xFFFFu || workers > Program::Server::WORKER_LIMIT) { std::fputs("usage: --serve [games] [port] [workers]\n", stderr); return EXIT_FAILURE; }
+
+    Program::Server::PORT         = static_cast<unsigned short>(port);
+    Program::Server::WORKER_COUNT = 0uL != workers ? workers : systemInformation.dwNumberOfProcessors < Program::Server::WORKER_LIMIT ? (systemInformation.dwNumberOfProcessors > 1u ? systemInformation.dwNumberOfProcessors : 1u) : Program::Server::WORKER_LIMIT;
+    for (Program::Server::QUEUE_CAPACITY = 1u; Program::Server::QUEUE_CAPACITY < games; ) Program::Server::QUEUE_CAPACITY <<= 1u;
+
+    Game::Network::FILE_NAME = "ChessNetwork.nnue"; // ->> Answered by the linear evaluation otherwise
+    Game::Network::load();
+
+    Program::Server::PENDING = ::CreateSemaphore(NULL, 0, 0x7FFFFFFF, NULL);
+    Program::Server::STATES  = static_cast<LONG volatile*>(std::calloc(games, sizeof(LONG)));
+    for (DWORD index = 0u; index != Program::Server::WORKER_COUNT; ++index) Program::Server::WORKERS[index].tasks = static_cast<Task*>(std::malloc(Program::Server::QUEUE_CAPACITY * sizeof(Task)));
+
+    if (0 == ::WSAStartup(MAKEWORD(2, 2), &data)) {
+        address.sin_addr.s_addr = ::htonl(INADDR_LOOPBACK);
+        address.sin_family      = AF_INET;
+        address.sin_port        = ::htons(Program::Server::PORT);
+        listener                = ::socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+        listening               = INVALID_SOCKET != listener && SOCKET_ERROR != ::bind(listener, reinterpret_cast<sockaddr const*>(&address), sizeof(address)) && SOCKET_ERROR != ::listen(listener, SOMAXCONN);
+    }
+
+    for (DWORD index = 0u; index != Program::Server::WORKER_COUNT; ++index) listening = listening && NULL != Program::Server::WORKERS[index].tasks;
+    if (false == listening || NULL == Program::Server::PENDING || NULL == Program::Server::STATES || false == Game::reserveContexts(games)) {
+        std::fprintf(stderr, "Unable to serve %lu games on 127.0.0.1:%u\n", games, port);
+        if (INVALID_SOCKET != listener) ::closesocket(listener);
+        if (NULL != Program::Server::PENDING) ::CloseHandle(Program::Server::PENDING);
+        for (DWORD index = 0u; index != Program::Server::WORKER_COUNT; ++index) std::free(Program::Server::WORKERS[index].tasks);
+        std::free(const_cast<LONG*>(Program::Server::STATES));
+        std::free(Game::Network::FEATURE_WEIGHTS);
+        ::WSACleanup();
+
+        return EXIT_FAILURE;
+    }
+
+    Program::Metrics::start();
+    for (DWORD index = 0u; index != Program::Server::WORKER_COUNT; ++index) Program::Server::WORKERS[index].thread = ::CreateThread(NULL, 0u, &Program::Server::run, Program::Server::WORKERS + index, 0x0u, NULL);
+    std::printf("Serving %lu games on 127.0.0.1:%u with %lu workers\n", games, port, static_cast<unsigned long>(Program::Server::WORKER_COUNT));
+    std::fflush(stdout);
+
+    // ... ->> Until interrupted; Each connection is read on a thread of its own, in the first free slot
+    for (SOCKET client; INVALID_SOCKET != (client = ::accept(listener, NULL, NULL)); ) {
+        Connection *connection = NULL;
+        BOOL const  delayless  = TRUE; // ->> Replies are whole messages; Nagle's algorithm would only hold them back
+
+        ::setsockopt(client, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<char const*>(&delayless), sizeof(delayless));
+        for (unsigned char index = 0u; index != Program::Server::CONNECTION_LIMIT; ++index)
+        if (0 == Program::Server::CONNECTIONS[index].used) { connection = Program::Server::CONNECTIONS + index; break; }
+
+        if (NULL == connection) { ::closesocket(client); continue; }
+        if (NULL != connection -> thread) ::CloseHandle(connection -> thread);
+
+        connection -> next    = 0u;
+        connection -> pending = 0;
+        connection -> socket  = client;
+        connection -> used    = 1;
+        connection -> thread  = ::CreateThread(NULL, 0u, &Program::Server::receive, connection, 0x0u, NULL);
+        if (NULL == connection -> thread) { ::closesocket(client); connection -> used = 0; }
+    }
+
+    ::closesocket(listener);
+    ::WSACleanup();
+
+    return EXIT_FAILURE;
+}
+
+// ... ->> Takes a task from `worker`: its oldest for its owner, else its newest
+bool Program::Server::pop(Program::Server::Worker& worker, Program::Server::Task& task, bool const oldest) {
+    bool popped;
+
+    if (worker.head == worker.tail) return false; // ->> Not worth the lock
+    while (0 != ::InterlockedExchange(&worker.lock, 1)) ::Sleep(0u);
+      popped = worker.head != worker.tail;
+      if (popped) task = worker.tasks[(oldest ? worker.head++ : --worker.tail) & (Program::Server::QUEUE_CAPACITY - 1u)];
+    ::InterlockedExchange(&worker.lock, 0);
+
+    return popped;
+}
+
+// ... ->> Never full: Each game has at most one task in flight, & the arena holds no more games than a queue does tasks
+void Program::Server::push(Program::Server::Worker& worker, Program::Server::Task const& task) {
+    while (0 != ::InterlockedExchange(&worker.lock, 1)) ::Sleep(0u);
+      worker.tasks[worker.tail & (Program::Server::QUEUE_CAPACITY - 1u)] = task;
+      ++worker.tail;
+    ::InterlockedExchange(&worker.lock, 0);
+
+    ::ReleaseSemaphore(Program::Server::PENDING, 1, NULL);
+}
+
+// ... ->> Reads requests off one connection; `OPEN` & `CLOSE` are answered here, each received batch in one send, while `MOVE`s are queued for the workers
+DWORD WINAPI Program::Server::receive(LPVOID const parameter) {
+    char              buffer [4096];
+    Connection *const connection = static_cast<Connection*>(parameter);
+    std::size_t       length     = 0u;
+    int               received;
+    Message           replies[sizeof(buffer) / sizeof(Message)];
+
+    while (0 < (received = ::recv(connection -> socket, buffer + length, static_cast<int>(sizeof(buffer) - length), 0))) {
+        std::size_t count  = 0u;
+        std::size_t offset = 0u;
+
+        for (length += static_cast<std::size_t>(received); length - offset >= sizeof(Message); offset += sizeof(Message)) {
+            Message        message;
+            Game::Context *context;
+            LONG volatile *state;
+
+            std::memcpy(&message, buffer + offset, sizeof(Message));
+            context = message.game < Game::Contexts::COUNT ? Game::Contexts::MEMORY + message.game : NULL;
+            state   = NULL != context ? Program::Server::STATES + message.game : NULL;
+
+            switch (message.kind) {
+                case Program::Server::CLOSE:
+                    message.code = NULL != state && 1 == ::InterlockedCompareExchange(state, 0, 1) ? Program::Server::OK : NULL != state && 0 != *state ? Program::Server::BUSY : Program::Server::UNKNOWN;
+                    if (Program::Server::OK == message.code) Game::releaseContext(context);
+                    break;
+
+                case Program::Server::MOVE:
+                    if (NULL != state && 1 == ::InterlockedCompareExchange(state, 2, 1)) {
+                        Task const task = {connection, message};
+
+                        ::InterlockedIncrement(&connection -> pending);
+                        Program::Server::push(Program::Server::WORKERS[connection -> next], task);
+                        connection -> next = (connection -> next + 1u) % Program::Server::WORKER_COUNT;
+                        continue;
+                    }
+
+                    message.code = NULL != state && 0 != *state ? Program::Server::BUSY : Program::Server::UNKNOWN;
+                    break;
+
+                case Program::Server::OPEN:
+                    context      = Game::acquireContext();
+                    message.code = NULL != context ? Program::Server::OK : Program::Server::FULL;
+
+                    if (NULL != context) {
+                        Game::CONTEXT = context;
+                        RESET();
+                        Game::CONTEXT = &Game::DEFAULT;
+
+                        message.game = static_cast<uint32_t>(context - Game::Contexts::MEMORY);
+                        ::InterlockedExchange(Program::Server::STATES + message.game, 1);
+                    }
+
+                    break;
+
+                default: message.code = Program::Server::UNKNOWN;
+            }
 
-    switch (type) {
-        case Piece::BISHOP: return *(this -> data) & 0x1Fu;
-        case Piece::KNIGHT: case Piece::PAWN: case Piece::ROOK: return *(this -> data) & 0x3Fu;
-        case Piece::KING: case Piece::QUEEN: {
-            Player const color = this -> getPlayer();
-            return (
-                ((*Game::getPiece(color, Piece::BISHOP, Piece::QUEEN == type ? 1u : 0u).data >> 6u) << 4u) |
-                ((*Game::getPiece(color, Piece::KNIGHT, Piece::QUEEN == type ? 1u : 0u).data >> 6u) << 2u) |
-                ((*Game::getPiece(color, Piece::ROOK  , Piece::QUEEN == type ? 1u : 0u).data >> 6u) << 0u)
-            );
-        } break;
+            replies[count++] = message;
+        }
+
+        std::memmove(buffer, buffer + offset, length - offset);
+        length -= offset;
+        if (0u != count) Program::Server::reply(*connection, replies, count * sizeof(Message));
     }
 
+    // ... ->> Games the client left open stay allocated
+    ::shutdown(connection -> socket, SD_BOTH);
+    while (0 != connection -> pending) ::Sleep(1u);
+    ::closesocket(connection -> socket);
+    ::InterlockedExchange(&connection -> used, 0);
+
     return 0u;
 }
 
-Player Piece::getPlayer() const {
-    for (Type const types[] = {Piece::QUEEN, Piece::KING, Piece::PAWN, Piece::BISHOP, Piece::KNIGHT, Piece::ROOK}, *type = types + (sizeof(types) / sizeof(Type)); type-- != types; )
-    for (unsigned char index = Piece::count(*type); index--; ) {
-        if (this -> data == Game::getPiece(Player::DARK , *type, index).data) return Player::DARK;
-        if (this -> data == Game::getPiece(Player::LIGHT, *type, index).data) return Player::LIGHT;
-    }
-
-    return static_cast<Player>(0x0u);
+void Program::Server::reply(Program::Server::Connection& connection, void const* const data, std::size_t const size) {
+    while (0 != ::InterlockedExchange(&connection.lock, 1)) ::Sleep(0u);
+      Program::Server::write(connection.socket, data, size);
+    ::InterlockedExchange(&connection.lock, 0);
 }
 
-bit<3u> Piece::getRow() const {
-    return Piece::BISHOP != this -> getType() ? (this -> getPosition() & 0x07u) >> 0x0u : (
-        this -> getPosition() / (Game::Tiles::COLUMN_COUNT / 2u)
-    );
-}
+// ... ->> `PENDING` counted one more task in, so some worker still holds it: This worker's oldest, else the next non-empty one's newest
+DWORD WINAPI Program::Server::run(LPVOID const parameter) {
+    std::size_t const index = static_cast<Worker*>(parameter) - Program::Server::WORKERS;
 
-Piece::Type Piece::getType() const {
-    for (Type const types[] = {Piece::QUEEN, Piece::KING, Piece::PAWN, Piece::BISHOP, Piece::KNIGHT, Piece::ROOK}, *type = types + (sizeof(types) / sizeof(Type)); type-- != types; ) {
-        for (unsigned char index = Piece::count(*type); index--; )
-        if (
-            this -> data == Game::getPiece(Player::DARK , *type, index).data ||
-            this -> data == Game::getPiece(Player::LIGHT, *type, index).data
-        ) return *type;
+    while (WAIT_OBJECT_0 == ::WaitForSingleObject(Program::Server::PENDING, INFINITE)) {
+        Task task;
+
+        for (std::size_t victim = index; false == Program::Server::pop(Program::Server::WORKERS[victim], task, index == victim); ) victim = (victim + 1u) % Program::Server::WORKER_COUNT;
+        Program::Server::answer(task);
     }
 
-    return static_cast<Type>(0x0u);
+    return 0u;
 }
 
-bool Piece::isCaptured() const {
-    switch (this -> getType()) {
-        case Piece::KING  : return false;
-        case Piece::PAWN  : return (Game::addressCapturedPawnData()[Player::LIGHT == this -> getPlayer() ? 1 : 0] >> this -> getIndex()) & 0x01u;
+bool Program::Server::write(SOCKET const socket, void const* const data, std::size_t const size) {
+    for (std::size_t sent = 0u; sent != size; ) {
+        int const count = ::send(socket, static_cast<char const*>(data) + sent, static_cast<int>(size - sent), 0);
 
-        case Piece::BISHOP: return ((Game::addressCapturedOfficerData()[0] >> 4u) >> (this -> getIndex() + (Player::LIGHT == this -> getPlayer() ? Piece::count(Piece::BISHOP) : 0u))) & 0x01u;
-        case Piece::KNIGHT: return ((Game::addressCapturedOfficerData()[0] >> 0u) >> (this -> getIndex() + (Player::LIGHT == this -> getPlayer() ? Piece::count(Piece::KNIGHT) : 0u))) & 0x01u;
-        case Piece::QUEEN : return ((Game::addressCapturedOfficerData()[1] >> 2u) >> (this -> getIndex() + (Player::LIGHT == this -> getPlayer() ? Piece::count(Piece::QUEEN ) : 0u))) & 0x01u;
-        case Piece::ROOK  : return ((Game::addressCapturedOfficerData()[1] >> 4u) >> (this -> getIndex() + (Player::LIGHT == this -> getPlayer() ? Piece::count(Piece::ROOK  ) : 0u))) & 0x01u;
+        if (count <= 0) return false;
+        sent += static_cast<std::size_t>(count);
     }
 
-    return false;
+    return true;
 }
 
-void Piece::setColumn(bit<3u> const column) {
-    this -> setPosition(column, this -> getRow());
-}
+void Program::Simulation::dispatch(Program::Input::Event const& event) {
+    switch (event.message) {
+        case WM_KEYDOWN: switch (event.parameter) {
+            /* ... */
+            case VK_ESCAPE: Game::Tiles::SELECTED ? Game::Tiles::SELECTED = false : Game::Tiles::HOVERED = false; break;
+            case VK_F2    : {
+                Program::Analysis::ENABLED = false == Program::Analysis::ENABLED;
+                Program::Analysis::PLAYER  = Player::LIGHT == Game::getTurn() ? Player::DARK : Player::LIGHT;
+                Program::Analysis::POSTED  = 0u;
+
+                if (false == Program::Analysis::ENABLED) ::InterlockedIncrement(&Program::Analysis::GENERATION);
+                UPDATE();
+            } break;
+            case VK_F3    : Program::Profiler::ENABLED = false == Program::Profiler::ENABLED; UPDATE(); break;
+            case VK_F5    : Program::Profiler::save(); break;
+            case VK_NEXT  : if (Game::Replay::seek(Game::Replay::PLY + 1uL)) { Game::Tiles::SELECTED = false; UPDATE(); } break;
+            case VK_PRIOR : if (0uL != Game::Replay::PLY && Game::Replay::seek(Game::Replay::PLY - 1uL)) { Game::Tiles::SELECTED = false; UPDATE(); } break;
+            case VK_RETURN: case VK_SPACE: {
+                if (Game::Tiles::HOVERED) {
+                    UPDATE();
+
+                    if (false == Game::Tiles::SELECTED) {
+                        Game::Tiles::SELECT  = Game::Tiles::HOVER;
+                        Game::Tiles::SELECTED = true;
+                    }
 
-void Piece::setPosition(bit<3u> const column, bit<3u> const row) {
-    Type const type = this -> getType();
+                    else if (Game::Tiles::SELECT != Game::Tiles::HOVER) {
+                        if ((Game::getDestinations(Game::Tiles::SELECT) >> Game::Tiles::HOVER) & 0x01u) Game::play(Game::Tiles::SELECT, Game::Tiles::HOVER);
+                        Game::Tiles::SELECTED = false;
+                    }
+                }
+            } break;
 
-    switch (type) {
-        case Piece::BISHOP: {
-            Player const color = this -> getPlayer();
-            unsigned char const index = this -> getIndex();
-            unsigned char position = (Game::Tiles::COLUMN_COUNT * Game::Tiles::ROW_COUNT) / 2u;
+            /* ... */
+            case VK_DOWN : {
+                Game::Tiles::HOVER = Game::Tiles::HOVERED * (
+                    (((Game::Tiles::HOVER % Game::Tiles::COLUMN_COUNT) - 0u) % Game::Tiles::COLUMN_COUNT) +
+                    (((Game::Tiles::HOVER / Game::Tiles::COLUMN_COUNT) + 1u) % Game::Tiles::ROW_COUNT   ) * Game::Tiles::COLUMN_COUNT
+                );
+                Game::Tiles::HOVERED = true;
+            } UPDATE(); break;
 
-            while (position--) {
-                unsigned char const positionRow = position / (Game::Tiles::COLUMN_COUNT / 2u);
-                unsigned char const positionColumn = ((position * 2u) % Game::Tiles::COLUMN_COUNT) + (positionRow % 2u
-                    ? index == (Player::LIGHT == color ? 0u : 1u)
-                    : index == (Player::LIGHT == color ? 1u : 0u)
+            case VK_LEFT : {
+                Game::Tiles::HOVER = Game::Tiles::HOVERED * (
+                    (((Game::Tiles::HOVER % Game::Tiles::COLUMN_COUNT) - 1u) % Game::Tiles::COLUMN_COUNT) +
+                    (((Game::Tiles::HOVER / Game::Tiles::COLUMN_COUNT) + 0u) % Game::Tiles::ROW_COUNT   ) * Game::Tiles::COLUMN_COUNT
                 );
+                Game::Tiles::HOVERED = true;
+            } UPDATE(); break;
 
-                if (column == positionColumn && row == positionRow) {
-                    *(this -> data) &= 0xE0u;
-                    *(this -> data) |= position;
+            case VK_RIGHT: {
+                Game::Tiles::HOVER = Game::Tiles::HOVERED * (
+                    (((Game::Tiles::HOVER % Game::Tiles::COLUMN_COUNT) + 1u) % Game::Tiles::COLUMN_COUNT) +
+                    (((Game::Tiles::HOVER / Game::Tiles::COLUMN_COUNT) - 0u) % Game::Tiles::ROW_COUNT   ) * Game::Tiles::COLUMN_COUNT
+                );
+                Game::Tiles::HOVERED = true;
+            } UPDATE(); break;
 
-                    break;
-                }
-            }
+            case VK_UP   : {
+                Game::Tiles::HOVER = Game::Tiles::HOVERED * (
+                    (((Game::Tiles::HOVER % Game::Tiles::COLUMN_COUNT) + 0u) % Game::Tiles::COLUMN_COUNT) +
+                    (((Game::Tiles::HOVER / Game::Tiles::COLUMN_COUNT) - 1u) % Game::Tiles::ROW_COUNT   ) * Game::Tiles::COLUMN_COUNT
+                );
+                Game::Tiles::HOVERED = true;
+            } UPDATE(); break;
         } break;
 
-        case Piece::KNIGHT: case Piece::PAWN: case Piece::ROOK: {
-            *(this -> data) &= 0xC0u;
-            *(this -> data) |= (column << 3u) | (row << 0u);
-        } break;
+        case WM_LBUTTONDOWN: {
+            Game::setHover(GET_X_LPARAM(event.subparameter), GET_Y_LPARAM(event.subparameter));
 
-        case Piece::KING: case Piece::QUEEN: {
-            Player const color = this -> getPlayer();
-            bit<8u> *const position[3] = {
-                Game::getPiece(color, Piece::BISHOP, Piece::QUEEN == type ? 1u : 0u).data,
-                Game::getPiece(color, Piece::KNIGHT, Piece::QUEEN == type ? 1u : 0u).data,
-                Game::getPiece(color, Piece::ROOK  , Piece::QUEEN == type ? 1u : 0u).data
-            };
+            if (Game::Tiles::HOVERED) {
+                UPDATE();
 
-            *position[0] &= 0x3Fu;
-            *position[1] &= 0x3Fu;
-            *position[2] &= 0x3Fu;
+                if (false == Game::Tiles::SELECTED) {
+                    Game::Tiles::SELECT  = Game::Tiles::HOVER;
+                    Game::Tiles::SELECTED = true;
+                }
 
-            *position[0] |= ((column & 0x06u) >> 1u) << 6u;
-            *position[1] |= ((((column & 0x01u) >> 0u) << 1u) | (((row & 0x04u) >> 2u) << 0u)) << 6u;
-            *position[2] |= ((row    & 0x03u) >> 0u) << 6u;
+                else if (Game::Tiles::SELECT != Game::Tiles::HOVER) {
+                    if ((Game::getDestinations(Game::Tiles::SELECT) >> Game::Tiles::HOVER) & 0x01u) Game::play(Game::Tiles::SELECT, Game::Tiles::HOVER);
+                    Game::Tiles::SELECTED = false;
+                }
+            }
         } break;
     }
 }
 
-void Piece::setRow(bit<3u> const row) {
-    this -> setPosition(this -> getColumn(), row);
+DWORD WINAPI Program::Simulation::run(LPVOID const) {
+    MSG message = MSG();
+
+    ::EnterCriticalSection(&Program::Simulation::STATE);
+      Program::State::publish(); // ->> The resumed position
+    ::LeaveCriticalSection(&Program::Simulation::STATE);
+
+    // ... ->> Sleep until input (or published analysis) arrives, or the next tick is due
+    Program::Loop::run(message, Program::Input::SIGNAL, &Program::Simulation::step, NULL != Program::ontick ? Program::TICK : 0u, &Program::Simulation::tick);
+    return 0u;
 }
 
-// : Program
-void Program::exit() { Program::exit(Program::EXIT_CODE); }
-void Program::exit(int const code) {
-    Program::EXIT_CODE = code;
+// ... ->> Applies the queued input; Stops the loop once `RUNNING` is cleared
+bool Program::Simulation::step() {
+    Program::Input::Event event;
 
-    if (NULL != Program::onexit) (*Program::onexit)();
-    std::exit(Program::EXIT_CODE);
+    if (false == Program::Simulation::RUNNING) return false;
+    ::EnterCriticalSection(&Program::Simulation::STATE);
+      while (Program::Input::pop(event)) {
+          if (0 == Program::Render::PENDING_TIME) Program::Render::PENDING_TIME = event.time;
+
+          // ... ->> Coalesce a burst of `WM_MOUSEMOVE`s into one hover update; Other input settles it first
+          if (WM_MOUSEMOVE == event.message) {
+              Window::POINTER.x     = GET_X_LPARAM(event.subparameter);
+              Window::POINTER.y     = GET_Y_LPARAM(event.subparameter);
+              Window::POINTER_MOVED = true;
+
+              continue;
+          }
+
+          if (Window::POINTER_MOVED) {
+              Window::POINTER_MOVED = false;
+              if (Game::setHover(Window::POINTER.x, Window::POINTER.y)) UPDATE();
+          }
+
+          Program::Simulation::dispatch(event);
+      }
+
+      if (Window::POINTER_MOVED) {
+          Window::POINTER_MOVED = false;
+          if (Game::setHover(Window::POINTER.x, Window::POINTER.y)) UPDATE();
+      }
+
+      // ... ->> Take up published analysis, or post the position input just changed
+      if ((Program::Analysis::READY & Program::Analysis::FRESH) || (Program::Analysis::ENABLED && Program::Analysis::POSTED != Game::CONTEXT -> hash)) UPDATE();
+      Program::State::publish();
+    ::LeaveCriticalSection(&Program::Simulation::STATE);
+
+    return true;
 }
 
-void Program::raise(int const signal) {
-    switch (signal) {
-        case SIGABRT: if (NULL != Program::onabort       ) (*Program::onabort)()       ; break;
-        case SIGFPE : if (NULL != Program::onmathfault   ) (*Program::onmathfault)()   ; break;
-        case SIGILL : if (NULL != Program::oninvalidfault) (*Program::oninvalidfault)(); break;
-        case SIGINT : if (NULL != Program::oninterrupt   ) (*Program::oninterrupt)()   ; break;
-        case SIGSEGV: if (NULL != Program::onsegfault    ) (*Program::onsegfault)()    ; break;
-        case SIGTERM: if (NULL != Program::onterminate   ) (*Program::onterminate)()   ; break;
-    } Program::exit(Program::EXIT_CODE);
+// ... ->> One fixed timestep of `Program::ontick`
+void Program::Simulation::tick() {
+    ::EnterCriticalSection(&Program::Simulation::STATE);
+      (*Program::ontick)();
+      Program::State::publish();
+    ::LeaveCriticalSection(&Program::Simulation::STATE);
 }
 
 // : Rook
@@ -572,12 +4688,53 @@ bool Rook::isCastled() const {
     )) & 0x01u;
 }
 
+// : Timer
+Timer::Timer(unsigned char const phase) : phase(phase), start() {
+    if (Program::Profiler::ENABLED) ::QueryPerformanceCounter(&this -> start);
+}
+
+Timer::~Timer() {
+    if (Program::Profiler::ENABLED && 0LL != this -> start.QuadPart) {
+        LARGE_INTEGER end;
+
+        ::QueryPerformanceCounter(&end);
+        Program::Profiler::record(this -> phase, this -> start.QuadPart, end.QuadPart);
+    }
+}
+
 /* Main */
 int WinMain(HINSTANCE const programHandle, HINSTANCE const programPreviousHandle, LPSTR const commandLineArguments, int const appearance) {
     Program::ARGUMENTS       = commandLineArguments;
     Program::HANDLE          = programHandle;
     Program::PREVIOUS_HANDLE = programPreviousHandle;
 
+    if (NULL != std::strstr(commandLineArguments, "--tune")) // ->> Offline; No window, lock or journal
+    return Program::Tuner::main(std::strstr(commandLineArguments, "--tune") + 6);
+
+    if (NULL != std::strstr(commandLineArguments, "--generate"))
+    return Program::Generator::main(std::strstr(commandLineArguments, "--generate") + 10);
+
+    if (NULL != std::strstr(commandLineArguments, "--watch"))
+    return Program::State::watch(std::strstr(commandLineArguments, "--watch") + 7);
+
+    if (NULL != std::strstr(commandLineArguments, "--tournament"))
+    return Program::Tournament::main(std::strstr(commandLineArguments, "--tournament") + 12);
+
+    if (NULL != std::strstr(commandLineArguments, "--index"))
+    return Program::Index::main(std::strstr(commandLineArguments, "--index") + 7);
+
+    if (NULL != std::strstr(commandLineArguments, "--bench"))
+    return Program::Benchmark::main(std::strstr(commandLineArguments, "--bench") + 7);
+
+    if (NULL != std::strstr(commandLineArguments, "--atlas"))
+    return Program::Atlas::main(std::strstr(commandLineArguments, "--atlas") + 7);
+
+    if (NULL != std::strstr(commandLineArguments, "--serve"))
+    return Program::Server::main(std::strstr(commandLineArguments, "--serve") + 7);
+
+    if (NULL != std::strstr(commandLineArguments, "--swarm"))
+    return Program::Swarm::main(std::strstr(commandLineArguments, "--swarm") + 7);
+
     Window::APPEARANCE = appearance;
 
     // ...
@@ -600,12 +4757,14 @@ void INITIATE() {
     bool programAlreadyRunning = false;
 
     // ... ->> Configuration
-    for (bit<8u> *data = Game::MEMORY + (sizeof(Game::MEMORY) / sizeof(bit<8u>)); data-- != Game::MEMORY; ) *data = 0x00u;
     Game::Board::COLOR             = 0x300F00u;
+    Game::Journal::FILE_NAME       = "ChessJournal.bin";
+    Game::Network::FILE_NAME       = "ChessNetwork.nnue";
     Game::Board::LEFT              = 0;
     Game::Board::HEIGHT            = 512u;
     Game::Board::TOP               = 0;
     Game::Board::WIDTH             = 512u;
+    Game::Pieces::ATLAS_FILE_NAME  = "pieces.atlas";
     Game::Pieces::BITMAP_FILE_NAME = "pieces.bmp";
     Game::Tiles::ANTICIPATE_COLOR  = 0xF0F000u;
     Game::Tiles::BEVEL             = 5u;
@@ -619,6 +4778,9 @@ void INITIATE() {
     Program::onexit           = static_cast<void (*)()>(&TERMINATE);
     Program::Lock::FILE_NAME  = "ChessLockFile.tmp";
     Program::Lock::MUTEX_NAME = "ChessLockMutex";
+    Program::Profiler::FILE_NAME = "ChessProfile.json";
+    ::QueryPerformanceFrequency(&Program::Profiler::FREQUENCY);
+    ::InitializeCriticalSection(&Program::Simulation::STATE);
 
     Window::BACKGROUND = ::GetSysColorBrush(COLOR_WINDOW);
     Window::CURSOR     = ::LoadCursor(NULL, IDC_ARROW); // --> static_cast<HCURSOR>(::LoadImage(NULL, MAKEINTRESOURCE(OCR_NORMAL), IMAGE_CURSOR, 0, 0, LR_DEFAULTCOLOR | LR_DEFAULTSIZE | LR_SHARED))
@@ -628,26 +4790,7 @@ void INITIATE() {
     Window::TITLE      = "Chess";
 
     // ... ->> Setup
-    Game::getPiece(Player::DARK , Piece::ROOK  , 0u).setPosition(0u, 7u);
-    Game::getPiece(Player::DARK , Piece::KNIGHT, 0u).setPosition(1u, 7u);
-    Game::getPiece(Player::DARK , Piece::BISHOP, 0u).setPosition(2u, 7u);
-    Game::getPiece(Player::DARK , Piece::KING      ).setPosition(3u, 7u);
-    Game::getPiece(Player::DARK , Piece::QUEEN     ).setPosition(4u, 7u);
-    Game::getPiece(Player::DARK , Piece::BISHOP, 1u).setPosition(5u, 7u);
-    Game::getPiece(Player::DARK , Piece::KNIGHT, 1u).setPosition(6u, 7u);
-    Game::getPiece(Player::DARK , Piece::ROOK  , 1u).setPosition(7u, 7u);
-    Game::getPiece(Player::LIGHT, Piece::ROOK  , 0u).setPosition(0u, 0u);
-    Game::getPiece(Player::LIGHT, Piece::KNIGHT, 0u).setPosition(1u, 0u);
-    Game::getPiece(Player::LIGHT, Piece::BISHOP, 0u).setPosition(2u, 0u);
-    Game::getPiece(Player::LIGHT, Piece::KING      ).setPosition(3u, 0u);
-    Game::getPiece(Player::LIGHT, Piece::QUEEN     ).setPosition(4u, 0u);
-    Game::getPiece(Player::LIGHT, Piece::BISHOP, 1u).setPosition(5u, 0u);
-    Game::getPiece(Player::LIGHT, Piece::KNIGHT, 1u).setPosition(6u, 0u);
-    Game::getPiece(Player::LIGHT, Piece::ROOK  , 1u).setPosition(7u, 0u);
-    for (unsigned char iterator = Game::Tiles::COLUMN_COUNT; iterator--; ) Game::getPiece(Player::LIGHT, Piece::PAWN, iterator).setPosition(iterator, 1u);
-    for (unsigned char iterator = Game::Tiles::COLUMN_COUNT; iterator--; ) Game::getPiece(Player::DARK , Piece::PAWN, iterator).setPosition(iterator, 6u);
-
-    Game::setPlayerTurn(Player::LIGHT);
+    RESET();
 
     // Logic ->> Assert previous program instance
     if (NULL != Program::PREVIOUS_HANDLE) programAlreadyRunning = true;
@@ -704,6 +4847,12 @@ void INITIATE() {
     else {
         WNDCLASSEX classInformation;
 
+        // ... ->> Resume the last game, if journaled
+        Game::Network::load();
+        Game::Replay::begin();
+        Game::Journal::open();
+        Program::State::open(); // ->> Optional
+
         classInformation.cbClsExtra    = 0;
         classInformation.cbSize        = sizeof(WNDCLASSEX);
         classInformation.cbWndExtra    = 0;
@@ -735,14 +4884,103 @@ void INITIATE() {
             Window::HANDLE = ::CreateWindowEx(Window::STYLE_EXTENSION, Window::CLASS_NAME, Window::TITLE, Window::STYLE, Window::LEFT, Window::TOP, Window::WIDTH, Window::HEIGHT, NULL, static_cast<HMENU>(NULL), Program::HANDLE, reinterpret_cast<LPVOID>(static_cast<LPARAM>(Window::APPEARANCE)));
             if (NULL == Window::HANDLE) TERMINATE("Unable to create game window");
 
-            for (bool available = false; WM_QUIT != Program::THREAD_MESSAGE.message; ) {
-                available = ::PeekMessage(&Program::THREAD_MESSAGE, NULL, 0x0u, 0x0u, PM_REMOVE);
-                if (FALSE != available) ::DispatchMessage(&Program::THREAD_MESSAGE);
+            // ... ->> Simulation, render & analysis threads; The window thread is left with queuing input and presenting frames
+            Program::Analysis::SIGNAL     = ::CreateEvent(NULL, FALSE, FALSE, NULL);
+            Program::Input::SIGNAL        = ::CreateEvent(NULL, FALSE, FALSE, NULL);
+            Program::Render::SIGNAL       = ::CreateEvent(NULL, FALSE, TRUE /* ->> first frame */, NULL);
+            Program::Simulation::RUNNING  = true;
+            if (NULL == Program::Analysis::SIGNAL || NULL == Program::Input::SIGNAL || NULL == Program::Render::SIGNAL) TERMINATE("Unable to run game");
+
+            Program::Analysis::THREAD   = ::CreateThread(NULL, 0u, &Program::Analysis::run  , NULL, 0x0u, NULL);
+            Program::Render::THREAD     = ::CreateThread(NULL, 0u, &Program::Render::run    , NULL, 0x0u, NULL);
+            Program::Simulation::THREAD = ::CreateThread(NULL, 0u, &Program::Simulation::run, NULL, 0x0u, NULL);
+            if (NULL == Program::Analysis::THREAD || NULL == Program::Render::THREAD || NULL == Program::Simulation::THREAD) TERMINATE("Unable to run game");
+            Program::Metrics::start(); // ->> Optional
+            if (NULL != std::strstr(Program::ARGUMENTS, "--load")) Program::Load::start(std::strstr(Program::ARGUMENTS, "--load") + 6);
+
+            // ... ->> Block until a message arrives; The window thread has neither a signal nor a tick of its own
+            Program::EXIT_CODE = Program::Loop::run(Program::THREAD_MESSAGE, NULL, NULL, 0u, NULL);
+        }
+    }
+}
+
+/* : Render ->> Called on `Program::Render::THREAD` with `Program::Simulation::STATE` held */
+void RENDER() {
+    uint64_t anticipate = 0u;
 
-                Program::EXIT_CODE = Program::THREAD_MESSAGE.wParam;
-            }
+    /* ... ->> Anticipated Spaces ->> Cached per position, off the snapshot in `Game::CONTEXT` */ {
+        Timer const timer(Program::Profiler::ANTICIPATE);
+        if (Program::Render::FRAME.selected) anticipate = Game::getDestinations(Program::Render::FRAME.select);
+    }
+
+    /* ... ->> Board & Tiles ->> Cached layer, then the highlighted tile bevels over it */ {
+        Timer const timer(Program::Profiler::BOARD);
+
+        int const height = (Game::getTileHeight() + Game::Tiles::MARGIN) * Game::Tiles::ROW_COUNT;
+        int const width  = (Game::getTileWidth()  + Game::Tiles::MARGIN) * Game::Tiles::COLUMN_COUNT;
+
+        // ... ->> Nothing drawn this frame reaches past the board
+        Window::FRAMEBUFFER[Program::Render::BACK].setClip(Game::Board::LEFT, Game::Board::TOP, Game::Board::LEFT + width, Game::Board::TOP + height);
+
+        if (Game::Board::LAYER_INVALID) Game::drawBoardLayer();
+        if (NULL != Game::Board::LAYER) Window::FRAMEBUFFER[Program::Render::BACK].blit(Game::Board::LEFT, Game::Board::TOP, Game::Board::LAYER, width, width, height);
+
+        for (unsigned char tile = Game::Tiles::COLUMN_COUNT * Game::Tiles::ROW_COUNT; tile--; ) if ((anticipate >> tile) & 0x01u) Game::drawTileBevel(tile, Game::Tiles::ANTICIPATE_COLOR);
+        if (Program::Render::FRAME.hovered ) Game::drawTileBevel(Program::Render::FRAME.hover , Game::Tiles::HOVER_COLOR );
+        if (Program::Render::FRAME.selected) Game::drawTileBevel(Program::Render::FRAME.select, Game::Tiles::SELECT_COLOR);
+    }
+
+    /* ... ->> Pieces ->> Pre-scaled, trimmed & premultiplied sprites */ {
+        Timer const timer(Program::Profiler::PIECES);
+        unsigned short const pieceHeight = (Game::getTileHeight() * 2u) / 3u;
+        unsigned short const pieceWidth  = (Game::getTileWidth()  * 2u) / 3u;
+
+        if (Game::Pieces::LAYER_INVALID) Game::drawPieceLayer();
+        if (NULL != Game::Pieces::SPRITES)
+        for (Piece piece = Game::getFirstPiece(); NULL != piece.data; piece = Game::getNextPiece(piece)) {
+            if (piece.isCaptured()) continue;
+
+            int const                        left   = Game::Board::LEFT + (piece.getColumn() * (Game::getTileWidth()  + Game::Tiles::MARGIN)) + Game::Tiles::MARGIN + (((Game::getTileWidth()  - Game::Tiles::MARGIN) - pieceWidth ) / 2);
+            int const                        top    = Game::Board::TOP  + (piece.getRow()    * (Game::getTileHeight() + Game::Tiles::MARGIN)) + Game::Tiles::MARGIN + (((Game::getTileHeight() - Game::Tiles::MARGIN) - pieceHeight) / 2);
+            Game::Pieces::AtlasSprite const &sprite = Game::Pieces::SPRITES[piece.getType() + (Player::LIGHT == piece.getPlayer() ? 6u : 0u)];
+
+            // ...
+            Window::FRAMEBUFFER[Program::Render::BACK].blit(left + sprite.left, top + sprite.top, reinterpret_cast<UINT32 const*>(Game::Pieces::SPRITES_MEMORY + sprite.offset), sprite.width, sprite.width, sprite.height, true);
         }
+
+        Window::FRAMEBUFFER[Program::Render::BACK].setClip(0, 0, Window::WIDTH, Window::HEIGHT);
     }
+
+    // ... ->> Instrumentation overlay
+    if (Program::Profiler::ENABLED) Program::Profiler::draw(Window::MEMORY_DEVICE_CONTEXT_HANDLE[Program::Render::BACK]);
+}
+
+/* : Reset ->> Start position, in the current context */
+void RESET() {
+    for (bit<8u> *data = Game::CONTEXT -> memory + (sizeof(Game::CONTEXT -> memory) / sizeof(bit<8u>)); data-- != Game::CONTEXT -> memory; ) *data = 0x00u;
+    Game::CONTEXT -> accumulated = 0x00u;
+
+    Game::getPiece(Player::DARK , Piece::ROOK  , 0u).setPosition(0u, 7u);
+    Game::getPiece(Player::DARK , Piece::KNIGHT, 0u).setPosition(1u, 7u);
+    Game::getPiece(Player::DARK , Piece::BISHOP, 0u).setPosition(2u, 7u);
+    Game::getPiece(Player::DARK , Piece::KING      ).setPosition(3u, 7u);
+    Game::getPiece(Player::DARK , Piece::QUEEN     ).setPosition(4u, 7u);
+    Game::getPiece(Player::DARK , Piece::BISHOP, 1u).setPosition(5u, 7u);
+    Game::getPiece(Player::DARK , Piece::KNIGHT, 1u).setPosition(6u, 7u);
+    Game::getPiece(Player::DARK , Piece::ROOK  , 1u).setPosition(7u, 7u);
+    Game::getPiece(Player::LIGHT, Piece::ROOK  , 0u).setPosition(0u, 0u);
+    Game::getPiece(Player::LIGHT, Piece::KNIGHT, 0u).setPosition(1u, 0u);
+    Game::getPiece(Player::LIGHT, Piece::BISHOP, 0u).setPosition(2u, 0u);
+    Game::getPiece(Player::LIGHT, Piece::KING      ).setPosition(3u, 0u);
+    Game::getPiece(Player::LIGHT, Piece::QUEEN     ).setPosition(4u, 0u);
+    Game::getPiece(Player::LIGHT, Piece::BISHOP, 1u).setPosition(5u, 0u);
+    Game::getPiece(Player::LIGHT, Piece::KNIGHT, 1u).setPosition(6u, 0u);
+    Game::getPiece(Player::LIGHT, Piece::ROOK  , 1u).setPosition(7u, 0u);
+    for (unsigned char iterator = Game::Tiles::COLUMN_COUNT; iterator--; ) Game::getPiece(Player::LIGHT, Piece::PAWN, iterator).setPosition(iterator, 1u);
+    for (unsigned char iterator = Game::Tiles::COLUMN_COUNT; iterator--; ) Game::getPiece(Player::DARK , Piece::PAWN, iterator).setPosition(iterator, 6u);
+
+    Game::setPlayerTurn(Player::LIGHT);
+    Game::rehash();
 }
 
 /* : Update */
@@ -769,8 +5007,30 @@ void UPDATE() {
 
     else {}
 
-    /* if (FALSE != ::GetUpdateRect(Window::HANDLE, NULL, FALSE)) */
-    ::RedrawWindow(Window::HANDLE, NULL, NULL, RDW_INTERNALPAINT);
+    // ... ->> Analysis, read without locking through `Program::Analysis::READY`; The engine moves once its search of the shown position completes
+    if (Program::Analysis::READY & Program::Analysis::FRESH)
+    Program::Analysis::FRONT = ::InterlockedExchange(&Program::Analysis::READY, Program::Analysis::FRONT) & ~Program::Analysis::FRESH;
+
+    if (Program::Analysis::ENABLED) {
+        Program::Analysis::Snapshot const &snapshot = Program::Analysis::SNAPSHOTS[Program::Analysis::FRONT];
+
+        if (Program::Analysis::PLAYER == Game::getTurn() && Game::Replay::PLY == Game::Replay::PLY_COUNT && snapshot.hash == Game::CONTEXT -> hash) {
+            if (snapshot.complete) {
+                if (Game::Replay::MOVELESS != snapshot.move[0]) Game::play(snapshot.move[0], snapshot.move[1]);
+                Game::Tiles::SELECTED = false;
+            }
+
+            else if (Program::Analysis::GENERATION == snapshot.job && Program::Analysis::POSTED != Game::CONTEXT -> hash) { // ->> Being pondered; Keep searching, on the engine's time
+                ::InterlockedExchange(&Program::Analysis::DEADLINE, static_cast<LONG>(::GetTickCount() + Program::Analysis::THINK_TIME));
+                Program::Analysis::POSTED = Game::CONTEXT -> hash;
+            }
+        }
+
+        if (Program::Analysis::POSTED != Game::CONTEXT -> hash)
+        Program::Analysis::post(Program::Analysis::PLAYER == Game::getTurn() ? ::GetTickCount() + Program::Analysis::THINK_TIME : 0u);
+    }
+
+    ::SetEvent(Program::Render::SIGNAL); // ->> Rendered on `Program::Render::THREAD`
 
     static_cast<void>(Game::getTurn);
     static_cast<void>(Game::Tiles::CURSOR);
@@ -784,97 +5044,15 @@ LRESULT CALLBACK UPDATE(HWND const windowHandle, UINT const message, WPARAM cons
         case WM_SYSKEYDOWN: if (VK_F4     == parameter) ::DestroyWindow(windowHandle); break;
 
         /* ... */
-        case WM_KEYDOWN: {
-            switch (parameter) {
-                /* ... */
-                case VK_ESCAPE: Game::Tiles::SELECTED ? Game::Tiles::SELECTED = false : Game::Tiles::HOVERED = false; break;
-                case VK_RETURN: case VK_SPACE: {
-                    if (Game::Tiles::HOVERED) {
-                        UPDATE();
-
-                        if (false == Game::Tiles::SELECTED) {
-                            Game::Tiles::SELECT  = Game::Tiles::HOVER;
-                            Game::Tiles::SELECTED = true;
-                        }
-                    }
-                } break;
-
-                /* ... */
-                case VK_DOWN : {
-                    Game::Tiles::HOVER = Game::Tiles::HOVERED * (
-                        (((Game::Tiles::HOVER % Game::Tiles::COLUMN_COUNT) - 0u) % Game::Tiles::COLUMN_COUNT) +
-                        (((Game::Tiles::HOVER / Game::Tiles::COLUMN_COUNT) + 1u) % Game::Tiles::ROW_COUNT   ) * Game::Tiles::COLUMN_COUNT
-                    );
-                    Game::Tiles::HOVERED = true;
-                } UPDATE(); break;
-
-                case VK_LEFT : {
-                    Game::Tiles::HOVER = Game::Tiles::HOVERED * (
-                        (((Game::Tiles::HOVER % Game::Tiles::COLUMN_COUNT) - 1u) % Game::Tiles::COLUMN_COUNT) +
-                        (((Game::Tiles::HOVER / Game::Tiles::COLUMN_COUNT) + 0u) % Game::Tiles::ROW_COUNT   ) * Game::Tiles::COLUMN_COUNT
-                    );
-                    Game::Tiles::HOVERED = true;
-                } UPDATE(); break;
-
-                case VK_RIGHT: {
-                    Game::Tiles::HOVER = Game::Tiles::HOVERED * (
-                        (((Game::Tiles::HOVER % Game::Tiles::COLUMN_COUNT) + 1u) % Game::Tiles::COLUMN_COUNT) +
-                        (((Game::Tiles::HOVER / Game::Tiles::COLUMN_COUNT) - 0u) % Game::Tiles::ROW_COUNT   ) * Game::Tiles::COLUMN_COUNT
-                    );
-                    Game::Tiles::HOVERED = true;
-                } UPDATE(); break;
-
-                case VK_UP   : {
-                    Game::Tiles::HOVER = Game::Tiles::HOVERED * (
-                        (((Game::Tiles::HOVER % Game::Tiles::COLUMN_COUNT) + 0u) % Game::Tiles::COLUMN_COUNT) +
-                        (((Game::Tiles::HOVER / Game::Tiles::COLUMN_COUNT) - 1u) % Game::Tiles::ROW_COUNT   ) * Game::Tiles::COLUMN_COUNT
-                    );
-                    Game::Tiles::HOVERED = true;
-                } UPDATE(); break;
-            }
-        } break;
-
+        case WM_KEYDOWN: /* ->> Handled on `Program::Simulation::THREAD` */ Program::Input::push(message, parameter, subparameter); break;
         case WM_LBUTTONDOWN: {
             if (MOUSEEVENTF_FROMTOUCH == (::GetMessageExtraInfo() & MOUSEEVENTF_FROMTOUCH)) break;
-            if (Game::Tiles::HOVERED) {
-                UPDATE();
-
-                if (false == Game::Tiles::SELECTED) {
-                    Game::Tiles::SELECT  = Game::Tiles::HOVERED;
-                    Game::Tiles::SELECTED = true;
-                }
-            }
+            Program::Input::push(message, parameter, subparameter);
         } break;
 
         case WM_MOUSEMOVE: {
-            if (MOUSEEVENTF_FROMTOUCH != (::GetMessageExtraInfo() & MOUSEEVENTF_FROMTOUCH)) {
-                unsigned char const hovered  = Game::Tiles::HOVER;
-                bool const          hovering = Game::Tiles::HOVERED;
-                int const pointerX = GET_X_LPARAM(subparameter);
-                int const pointerY = GET_Y_LPARAM(subparameter);
-
-                // ...
-                Game::Tiles::HOVERED = false;
-                for (unsigned char row    = Game::Tiles::ROW_COUNT   ; row--   ; )
-                for (unsigned char column = Game::Tiles::COLUMN_COUNT; column--; ) {
-                    int const x = Game::Board::LEFT + (column * (Game::getTileWidth()  + Game::Tiles::MARGIN));
-                    int const y = Game::Board::TOP  + (row    * (Game::getTileHeight() + Game::Tiles::MARGIN));
-
-                    if (
-                        (pointerX >= x + Game::Tiles::MARGIN && pointerX < x + Game::getTileWidth() ) &&
-                        (pointerY >= y + Game::Tiles::MARGIN && pointerY < y + Game::getTileHeight())
-                    ) {
-                        Game::Tiles::HOVER  = column + (row * Game::Tiles::COLUMN_COUNT);
-                        Game::Tiles::HOVERED = true;
-                    }
-                }
-
-                // ...
-                if (
-                    hovered  != Game::Tiles::HOVER &&
-                    hovering != Game::Tiles::HOVERED
-                ) UPDATE();
-            }
+            if (MOUSEEVENTF_FROMTOUCH != (::GetMessageExtraInfo() & MOUSEEVENTF_FROMTOUCH))
+            Program::Input::push(message, parameter, subparameter);
         } break;
 
         case WM_LBUTTONUP  : /* ->> Called by `WM_TOUCH` afterward */ break;
@@ -934,48 +5112,34 @@ LRESULT CALLBACK UPDATE(HWND const windowHandle, UINT const message, WPARAM cons
                 bitmapInformation.bmiHeader.biXPelsPerMeter = ::GetDeviceCaps(Window::DEVICE_CONTEXT_HANDLE, HORZRES) / ::GetDeviceCaps(Window::DEVICE_CONTEXT_HANDLE, HORZSIZE);
                 bitmapInformation.bmiHeader.biYPelsPerMeter = ::GetDeviceCaps(Window::DEVICE_CONTEXT_HANDLE, VERTRES) / ::GetDeviceCaps(Window::DEVICE_CONTEXT_HANDLE, VERTSIZE);
 
-                // ...
-                Window::MEMORY_DEVICE_CONTEXT_HANDLE = ::CreateCompatibleDC(Window::DEVICE_CONTEXT_HANDLE);
-                if (NULL == Window::MEMORY_DEVICE_CONTEXT_HANDLE) TERMINATE("Unable to render on game window");
+                // ... ->> One frame per `Program::Render` buffer
+                for (unsigned char frame = 0u; frame != 3u; ++frame) {
+                    Window::MEMORY_DEVICE_CONTEXT_HANDLE[frame] = ::CreateCompatibleDC(Window::DEVICE_CONTEXT_HANDLE);
+                    if (NULL == Window::MEMORY_DEVICE_CONTEXT_HANDLE[frame]) TERMINATE("Unable to render on game window");
 
-                Window::MEMORY_DEVICE_CONTEXT_BITMAP_HANDLE = ::CreateDIBSection(Window::MEMORY_DEVICE_CONTEXT_HANDLE, &bitmapInformation, DIB_RGB_COLORS, static_cast<VOID**>(static_cast<void*>(&Window::MEMORY_DEVICE_CONTEXT_BITMAP_MEMORY)), NULL, 0u);
-                if (NULL == Window::MEMORY_DEVICE_CONTEXT_BITMAP_HANDLE && NULL == Window::MEMORY_DEVICE_CONTEXT_BITMAP_MEMORY) TERMINATE("Unable to render on game window");
-            }
+                    Window::MEMORY_DEVICE_CONTEXT_BITMAP_HANDLE[frame] = ::CreateDIBSection(Window::MEMORY_DEVICE_CONTEXT_HANDLE[frame], &bitmapInformation, DIB_RGB_COLORS, static_cast<VOID**>(static_cast<void*>(Window::MEMORY_DEVICE_CONTEXT_BITMAP_MEMORY + frame)), NULL, 0u);
+                    if (NULL == Window::MEMORY_DEVICE_CONTEXT_BITMAP_HANDLE[frame] && NULL == Window::MEMORY_DEVICE_CONTEXT_BITMAP_MEMORY[frame]) TERMINATE("Unable to render on game window");
 
-            /* ... ->> Game pieces bitmap and graphics context */ {
-                Game::Pieces::BITMAP_HANDLE = static_cast<HBITMAP>(::LoadImage(static_cast<HINSTANCE>(NULL), Game::Pieces::BITMAP_FILE_NAME, IMAGE_BITMAP, 0, 0, LR_CREATEDIBSECTION | LR_DEFAULTCOLOR | LR_LOADFROMFILE));
-
-                if (NULL != Game::Pieces::BITMAP_HANDLE) Game::Pieces::BITMAP_DEVICE_CONTEXT_HANDLE = ::CreateCompatibleDC(Window::DEVICE_CONTEXT_HANDLE);
-                if (NULL != Game::Pieces::BITMAP_DEVICE_CONTEXT_HANDLE) {
-                    ::GetObject(Game::Pieces::BITMAP_HANDLE, sizeof(BITMAP), &Game::Pieces::BITMAP);
-                    Game::Pieces::BITMAP_MEMORY = static_cast<UINT32*>(std::malloc(Game::Pieces::BITMAP.bmHeight * Game::Pieces::BITMAP.bmWidth * sizeof(UINT32)));
-
-                    if (NULL != Game::Pieces::BITMAP_MEMORY) {
-                        bitmapInformation.bmiHeader.biHeight        = -Game::Pieces::BITMAP.bmHeight;
-                        bitmapInformation.bmiHeader.biPlanes        = Game::Pieces::BITMAP.bmPlanes;
-                        bitmapInformation.bmiHeader.biSizeImage     = Game::Pieces::BITMAP.bmHeight * Game::Pieces::BITMAP.bmWidth * sizeof(UINT32);
-                        bitmapInformation.bmiHeader.biWidth         = +Game::Pieces::BITMAP.bmWidth;
-                        bitmapInformation.bmiHeader.biXPelsPerMeter = ::GetDeviceCaps(Game::Pieces::BITMAP_DEVICE_CONTEXT_HANDLE, HORZRES) / ::GetDeviceCaps(Game::Pieces::BITMAP_DEVICE_CONTEXT_HANDLE, HORZSIZE);
-                        bitmapInformation.bmiHeader.biYPelsPerMeter = ::GetDeviceCaps(Game::Pieces::BITMAP_DEVICE_CONTEXT_HANDLE, VERTRES) / ::GetDeviceCaps(Game::Pieces::BITMAP_DEVICE_CONTEXT_HANDLE, VERTSIZE);
-
-                        // ...
-                        ::GetDIBits(Game::Pieces::BITMAP_DEVICE_CONTEXT_HANDLE, Game::Pieces::BITMAP_HANDLE, 0u, Game::Pieces::BITMAP.bmHeight, Game::Pieces::BITMAP_MEMORY, &bitmapInformation, DIB_RGB_COLORS);
-                        ::SelectObject(Game::Pieces::BITMAP_DEVICE_CONTEXT_HANDLE, Game::Pieces::BITMAP_HANDLE);
-                    }
+                    Window::FRAMEBUFFER[frame] = Framebuffer(Window::MEMORY_DEVICE_CONTEXT_BITMAP_MEMORY[frame], bitmapInformation.bmiHeader);
                 }
             }
 
+            // ... ->> Game pieces ->> Read in-place from a read-only view of the atlas (or else the bitmap); No decoding or intermediate copy
+            if (false == Game::Pieces::loadAtlas()) Game::Pieces::loadBitmap();
+
             // ... ->> Setup
             Game::Board::HEIGHT = ((Window::HEIGHT < Window::WIDTH ? Window::HEIGHT : Window::WIDTH) * 9) / 10;
             Game::Board::WIDTH  = ((Window::HEIGHT < Window::WIDTH ? Window::HEIGHT : Window::WIDTH) * 9) / 10;
             Game::Board::LEFT = (Window::WIDTH  - (Game::Board::WIDTH  + (Game::Tiles::MARGIN * (Game::Tiles::COLUMN_COUNT - 1)))) / 2;
             Game::Board::TOP  = (Window::HEIGHT - (Game::Board::HEIGHT + (Game::Tiles::MARGIN * (Game::Tiles::ROW_COUNT    - 1)))) / 2;
+            Game::Board::LAYER_INVALID  = true;
+            Game::Pieces::LAYER_INVALID = true;
 
             ::FreeConsole();
-            ::GetObject(Window::MEMORY_DEVICE_CONTEXT_BITMAP_HANDLE, sizeof(BITMAP), &Window::MEMORY_DEVICE_CONTEXT_BITMAP);
+            for (unsigned char frame = 0u; frame != 3u; ++frame) ::GetObject(Window::MEMORY_DEVICE_CONTEXT_BITMAP_HANDLE[frame], sizeof(BITMAP), Window::MEMORY_DEVICE_CONTEXT_BITMAP + frame);
 
             ::SelectObject(Window::DEVICE_CONTEXT_HANDLE, Window::DEVICE_CONTEXT_BITMAP_HANDLE);
-            ::SelectObject(Window::MEMORY_DEVICE_CONTEXT_HANDLE, Window::MEMORY_DEVICE_CONTEXT_BITMAP_HANDLE);
+            for (unsigned char frame = 0u; frame != 3u; ++frame) ::SelectObject(Window::MEMORY_DEVICE_CONTEXT_HANDLE[frame], Window::MEMORY_DEVICE_CONTEXT_BITMAP_HANDLE[frame]);
             ::ShowWindow(windowHandle, /* --> SW_SHOWDEFAULT */ static_cast<long>(static_cast<int>(reinterpret_cast<intptr_t>(creationParameter))));
             #ifdef WM_TOUCH
               if (0 != ::GetSystemMetrics(0x5E /* --> SM_DIGITIZER */))
@@ -985,7 +5149,25 @@ LRESULT CALLBACK UPDATE(HWND const windowHandle, UINT const message, WPARAM cons
 
         // ...
         case WM_DESTROY: {
-            ::DeleteDC(Window::MEMORY_DEVICE_CONTEXT_HANDLE); ::DeleteObject(Window::MEMORY_DEVICE_CONTEXT_BITMAP_HANDLE);
+            HANDLE const threads[] = {Program::Analysis::THREAD, Program::Render::THREAD, Program::Simulation::THREAD};
+
+            // ... ->> Stop every thread before the frames & state they use are released
+            Program::Simulation::RUNNING = false;
+            ::InterlockedIncrement(&Program::Analysis::GENERATION);
+            ::SetEvent(Program::Analysis::SIGNAL);
+            ::SetEvent(Program::Input::SIGNAL);
+            ::SetEvent(Program::Render::SIGNAL);
+
+            for (unsigned char index = 0u; index != 3u; ++index)
+            if (NULL != threads[index]) { ::WaitForSingleObject(threads[index], INFINITE); ::CloseHandle(threads[index]); }
+
+            Program::Analysis::THREAD   = NULL;
+            Program::Render::THREAD     = NULL;
+            Program::Simulation::THREAD = NULL;
+            Program::Load::stop();
+            Program::Metrics::stop();
+
+            for (unsigned char frame = 0u; frame != 3u; ++frame) { ::DeleteDC(Window::MEMORY_DEVICE_CONTEXT_HANDLE[frame]); ::DeleteObject(Window::MEMORY_DEVICE_CONTEXT_BITMAP_HANDLE[frame]); }
             ::ReleaseDC(windowHandle, Window::DEVICE_CONTEXT_HANDLE);
             Window::HANDLE = NULL;
 
@@ -995,169 +5177,25 @@ LRESULT CALLBACK UPDATE(HWND const windowHandle, UINT const message, WPARAM cons
         /* ... */
         case WM_ERASEBKGND: return 0x1L;
         case WM_PAINT: {
-            unsigned char anticipate[27], anticipateCount = 0u;
-            unsigned short const tileContentHeight = Game::getTileHeight() - Game::Tiles::MARGIN;
-            unsigned short const tileContentWidth  = Game::getTileWidth()  - Game::Tiles::MARGIN;
-            int x, y;
-
-            // ... ->> Anticipated Spaces
-            for (Piece piece = Game::getFirstPiece(); NULL != piece.data; piece = Game::getNextPiece(piece)) {
-                unsigned char const pieceColumn = piece.getColumn();
-                Player const        piecePlayer = piece.getPlayer();
-                unsigned char const pieceRow    = piece.getRow();
-
-                if (Game::Tiles::SELECTED && (
-                    pieceColumn == Game::Tiles::SELECT % Game::Tiles::COLUMN_COUNT &&
-                    pieceRow    == Game::Tiles::SELECT / Game::Tiles::COLUMN_COUNT
-                )) {
-                    bool anticipated = false;
-                    switch (piece.getType()) {
-                        case Piece::BISHOP: {
-                            for (unsigned char column = pieceColumn, row = pieceRow; false == anticipated && column-- != 0u                        && row-- != 0u                    ; ) {
-                                anticipate[anticipateCount++] = column + (row * Game::Tiles::COLUMN_COUNT);
-
-                                for (Piece gamePiece = Game::getFirstPiece(); NULL != gamePiece.data; gamePiece = Game::getNextPiece(gamePiece))
-                                if (column == gamePiece.getColumn() && row == gamePiece.getRow()) {
-                                    anticipateCount -= piecePlayer == gamePiece.getPlayer();
-                                    anticipated = true;
-
-                                    break;
-                                }
-                            }
-                            for (unsigned char column = pieceColumn, row = pieceRow; false == anticipated && column-- != 0u                        && ++row != Game::Tiles::ROW_COUNT; ) anticipate[anticipateCount++] = column + (row * Game::Tiles::COLUMN_COUNT);
-                            for (unsigned char column = pieceColumn, row = pieceRow; false == anticipated && ++column != Game::Tiles::COLUMN_COUNT && row-- != 0u                    ; ) anticipate[anticipateCount++] = column + (row * Game::Tiles::COLUMN_COUNT);
-                            for (unsigned char column = pieceColumn, row = pieceRow; false == anticipated && ++column != Game::Tiles::COLUMN_COUNT && ++row != Game::Tiles::ROW_COUNT; ) anticipate[anticipateCount++] = column + (row * Game::Tiles::COLUMN_COUNT);
-                        } break;
-                        case Piece::KING  : break;
-                        case Piece::KNIGHT: break;
-                        case Piece::PAWN  : break;
-                        case Piece::QUEEN : break;
-                        case Piece::ROOK  : break;
-                    }
-
-                    break;
-                }
-            }
+            /* ... ->> Present ->> Take the newest rendered frame, if any, else repeat the last */ {
+                Timer const timer(Program::Profiler::PRESENT);
 
-            // ... ->> Board & Tiles
-            for (unsigned short boardY = (Game::getTileHeight() + Game::Tiles::MARGIN) * Game::Tiles::ROW_COUNT   ; boardY--; )
-            for (unsigned short boardX = (Game::getTileWidth()  + Game::Tiles::MARGIN) * Game::Tiles::COLUMN_COUNT; boardX--; ) {
-                DWORD                tileColor;
-                unsigned char const  tileColumn = boardX / (Game::getTileWidth()  + Game::Tiles::MARGIN);
-                unsigned char const  tileRow    = boardY / (Game::getTileHeight() + Game::Tiles::MARGIN);
-                unsigned short const tileX      = boardX - (tileColumn * (Game::getTileWidth() + Game::Tiles::MARGIN));
-                unsigned short const tileY      = boardY - (tileRow    * (Game::getTileWidth() + Game::Tiles::MARGIN));
-
-                // ... ->> Board
-                x = Game::Board::LEFT + boardX;
-                y = Game::Board::TOP  + boardY;
-
-                if ((x > -1 && x < Window::WIDTH) && (y > -1 && y < Window::HEIGHT))
-                Window::MEMORY_DEVICE_CONTEXT_BITMAP_MEMORY[x + (y * Window::MEMORY_DEVICE_CONTEXT_BITMAP.bmWidth)] = 0xFF000000u | Game::Board::COLOR;
-
-                // ... ->> Tiles
-                tileColor = (tileColumn + tileRow) % 2u ? Game::Tiles::LIGHT_COLOR : Game::Tiles::DARK_COLOR;
-                x = Game::Board::LEFT + tileX + (tileColumn * (Game::getTileWidth()  + Game::Tiles::MARGIN));
-                y = Game::Board::TOP  + tileY + (tileRow    * (Game::getTileHeight() + Game::Tiles::MARGIN));
-
-                if (
-                    (tileX >= Game::Tiles::MARGIN && tileX < Game::getTileWidth() ) &&
-                    (tileY >= Game::Tiles::MARGIN && tileY < Game::getTileHeight())
-                ) {
-                    unsigned short const tileContentX = tileX - Game::Tiles::MARGIN;
-                    unsigned short const tileContentY = tileY - Game::Tiles::MARGIN;
-
-                    // ... ->> Bevel
-                    if (
-                        (tileContentX > tileContentWidth  - Game::Tiles::BEVEL || tileContentX < 0u + Game::Tiles::BEVEL) ||
-                        (tileContentY > tileContentHeight - Game::Tiles::BEVEL || tileContentY < 0u + Game::Tiles::BEVEL)
-                    ) {
-                        tileColor = (
-                            (((((tileColor >> 0x10u) & 0xFFu) * 2u) / 3u) << 0x10u) |
-                            (((((tileColor >> 0x08u) & 0xFFu) * 2u) / 3u) << 0x08u) |
-                            (((((tileColor >> 0x00u) & 0xFFu) * 2u) / 3u) << 0x00u)
-                        );
-
-                        // ...
-                        for (unsigned char anticipateIterator = anticipateCount; anticipateIterator--; )
-                        if (
-                            tileColumn == anticipate[anticipateIterator] % Game::Tiles::COLUMN_COUNT &&
-                            tileRow    == anticipate[anticipateIterator] / Game::Tiles::COLUMN_COUNT
-                        ) tileColor = Game::Tiles::ANTICIPATE_COLOR;
-
-                        if (Game::Tiles::HOVERED  && (
-                            tileColumn == Game::Tiles::HOVER % Game::Tiles::COLUMN_COUNT &&
-                            tileRow    == Game::Tiles::HOVER / Game::Tiles::COLUMN_COUNT
-                        )) tileColor = Game::Tiles::HOVER_COLOR;
-
-                        if (Game::Tiles::SELECTED && (
-                            tileColumn == Game::Tiles::SELECT % Game::Tiles::COLUMN_COUNT &&
-                            tileRow    == Game::Tiles::SELECT / Game::Tiles::COLUMN_COUNT
-                        )) tileColor = Game::Tiles::SELECT_COLOR;
-                    }
+                if (0x0 != (::InterlockedCompareExchange(&Program::Render::READY, 0, 0) & Program::Render::FRESH))
+                Program::Render::FRONT = ::InterlockedExchange(&Program::Render::READY, Program::Render::FRONT) & ~Program::Render::FRESH;
 
-                    // ...
-                    if ((x > -1 && x < Window::WIDTH) && (y > -1 && y < Window::HEIGHT))
-                    Window::MEMORY_DEVICE_CONTEXT_BITMAP_MEMORY[x + (y * Window::MEMORY_DEVICE_CONTEXT_BITMAP.bmWidth)] = 0xFF000000u | tileColor;
-                }
+                ::BitBlt(Window::DEVICE_CONTEXT_HANDLE, 0, 0, Window::WIDTH, Window::HEIGHT, Window::MEMORY_DEVICE_CONTEXT_HANDLE[Program::Render::FRONT], 0, 0, SRCCOPY);
             }
 
-            // ... ->> Pieces
-            for (Piece piece = Game::getFirstPiece(); NULL != piece.data; piece = Game::getNextPiece(piece)) {
-                unsigned short const pieceBitmapHeight = Game::Pieces::BITMAP.bmHeight / 2u;
-                unsigned short const pieceBitmapWidth  = Game::Pieces::BITMAP.bmWidth  / 6u;
-                DWORD const          pieceColor  = piece.getPlayer();
-                unsigned char const  pieceColumn = piece.getColumn();
-                unsigned short const pieceHeight = (Game::getTileHeight() * 2u) / 3u;
-                unsigned char const  pieceRow    = piece.getRow();
-                Piece::Type const    pieceType   = piece.getType();
-                unsigned short const pieceWidth  = (Game::getTileWidth()  * 2u) / 3u;
+            // ... ->> Input-to-present latency ->> `BitBlt(...)` completing is the nearest observable photon without vertical sync information
+            if (0 != Program::Render::INPUT_TIME[Program::Render::FRONT]) {
+                LARGE_INTEGER now;
 
-                // ...
-                for (unsigned short pieceY = Game::getTileHeight(); pieceY--; )
-                for (unsigned short pieceX = Game::getTileWidth() ; pieceX--; ) {
-                    x = pieceX + (Game::Board::LEFT + (pieceColumn * (Game::getTileWidth()  + Game::Tiles::MARGIN)) - ((Game::getTileWidth()  - pieceWidth ) / 2u));
-                    y = pieceY + (Game::Board::TOP  + (pieceRow    * (Game::getTileHeight() + Game::Tiles::MARGIN)) - ((Game::getTileHeight() - pieceHeight) / 2u));
-
-                    if (
-                        (x > -1 && x < Window::WIDTH) && (y > -1 && y < Window::HEIGHT) &&
-                        (pieceWidth > Game::getTileWidth() - pieceX) && (pieceHeight > Game::getTileHeight() - pieceY)
-                    ) {
-                        // ... ->> Bitmap/ computed
-                        if (NULL == Game::Pieces::BITMAP_HANDLE) {}
-                        else {
-                            DWORD          pieceBitmapColor;
-                            DWORD const    pieceBitmapMaskColor = *Game::Pieces::BITMAP_MEMORY;
-                            unsigned short pieceBitmapX = pieceBitmapWidth;
-                            unsigned short pieceBitmapY = Player::LIGHT == pieceColor ? pieceBitmapHeight : 0u;
-
-                            // ...
-                            switch (pieceType) {
-                                case Piece::BISHOP: pieceBitmapX *= 0u; break;
-                                case Piece::KING  : pieceBitmapX *= 1u; break;
-                                case Piece::KNIGHT: pieceBitmapX *= 2u; break;
-                                case Piece::PAWN  : pieceBitmapX *= 3u; break;
-                                case Piece::QUEEN : pieceBitmapX *= 4u; break;
-                                case Piece::ROOK  : pieceBitmapX *= 5u; break;
-                            }
-
-                            pieceBitmapX += ((pieceX - (((Game::getTileWidth()  - pieceWidth ) / 2u) + ((Game::getTileWidth()  - pieceWidth ) / 2u))) * pieceBitmapWidth ) / pieceWidth;
-                            pieceBitmapY += ((pieceY - (((Game::getTileHeight() - pieceHeight) / 2u) + ((Game::getTileHeight() - pieceHeight) / 2u))) * pieceBitmapHeight) / pieceHeight;
-
-                            // ...
-                            if (pieceBitmapX < Game::Pieces::BITMAP.bmWidth && pieceBitmapY < Game::Pieces::BITMAP.bmHeight) {
-                                pieceBitmapColor = Game::Pieces::BITMAP_MEMORY[pieceBitmapX + (pieceBitmapY * Game::Pieces::BITMAP.bmWidth)];
-
-                                if (pieceBitmapColor != pieceBitmapMaskColor)
-                                Window::MEMORY_DEVICE_CONTEXT_BITMAP_MEMORY[x + (y * Window::MEMORY_DEVICE_CONTEXT_BITMAP.bmWidth)] = 0xFF000000u | pieceBitmapColor;
-                            }
-                        }
-                    }
-                }
+                ::QueryPerformanceCounter(&now);
+                Program::Profiler::record(Program::Profiler::LATENCY, Program::Render::INPUT_TIME[Program::Render::FRONT], now.QuadPart);
+                Program::Render::INPUT_TIME[Program::Render::FRONT] = 0;
             }
 
-            // ...
-            ::BitBlt(Window::DEVICE_CONTEXT_HANDLE, 0, 0, Window::WIDTH, Window::HEIGHT, Window::MEMORY_DEVICE_CONTEXT_HANDLE, 0, 0, SRCCOPY);
+            ::ValidateRect(windowHandle, NULL); // ->> Otherwise `WM_PAINT` is re-sent for as long as the window stays invalid
         } return 0x0L;
     }
 
@@ -1168,12 +5206,29 @@ LRESULT CALLBACK UPDATE(HWND const windowHandle, UINT const message, WPARAM cons
 /* : Terminate */
 void TERMINATE() { TERMINATE(NULL); }
 void TERMINATE(char const message[]) {
-    std::free(Game::Pieces::BITMAP_MEMORY);
-    if (NULL != Game::Pieces::BITMAP_DEVICE_CONTEXT_HANDLE) ::DeleteObject(Game::Pieces::BITMAP_DEVICE_CONTEXT_HANDLE);
-    if (NULL != Game::Pieces::BITMAP_HANDLE) ::DeleteObject(Game::Pieces::BITMAP_HANDLE);
+    std::free(Game::Board::LAYER);
+    std::free(Game::Pieces::LAYER);
+    std::free(Game::Replay::KEYFRAMES);
+    std::free(Game::Replay::STREAM);
+    if (NULL != Game::Journal::VIEW) ::UnmapViewOfFile(Game::Journal::VIEW);
+    if (NULL != Game::Journal::FILE_MAPPING) ::CloseHandle(Game::Journal::FILE_MAPPING);
+    if (NULL != Game::Journal::FILE && INVALID_HANDLE_VALUE != Game::Journal::FILE) ::CloseHandle(Game::Journal::FILE);
+    std::free(Game::Network::FEATURE_WEIGHTS);
+    if (NULL != Game::Contexts::MEMORY) ::VirtualFree(Game::Contexts::MEMORY, 0u, MEM_RELEASE);
+    if (NULL != Game::Pieces::ATLAS_FILE_VIEW) ::UnmapViewOfFile(Game::Pieces::ATLAS_FILE_VIEW);
+    if (NULL != Game::Pieces::ATLAS_FILE_MAPPING) ::CloseHandle(Game::Pieces::ATLAS_FILE_MAPPING);
+    if (NULL != Game::Pieces::ATLAS_FILE && INVALID_HANDLE_VALUE != Game::Pieces::ATLAS_FILE) ::CloseHandle(Game::Pieces::ATLAS_FILE);
+    if (NULL != Game::Pieces::BITMAP_FILE_VIEW) ::UnmapViewOfFile(Game::Pieces::BITMAP_FILE_VIEW);
+    if (NULL != Game::Pieces::BITMAP_FILE_MAPPING) ::CloseHandle(Game::Pieces::BITMAP_FILE_MAPPING);
+    if (NULL != Game::Pieces::BITMAP_FILE && INVALID_HANDLE_VALUE != Game::Pieces::BITMAP_FILE) ::CloseHandle(Game::Pieces::BITMAP_FILE);
 
     if (NULL != Program::Lock::FILE && INVALID_HANDLE_VALUE != Program::Lock::FILE) ::CloseHandle(Program::Lock::FILE);
     if (NULL != Program::Lock::MUTEX) ::CloseHandle(Program::Lock::MUTEX);
+    if (NULL != Program::Analysis::SIGNAL) ::CloseHandle(Program::Analysis::SIGNAL);
+    if (NULL != Program::Input::SIGNAL) ::CloseHandle(Program::Input::SIGNAL);
+    if (NULL != Program::Render::SIGNAL) ::CloseHandle(Program::Render::SIGNAL);
+    if (NULL != Program::State::HEADER) ::UnmapViewOfFile(Program::State::HEADER);
+    if (NULL != Program::State::MAPPING) ::CloseHandle(Program::State::MAPPING);
 
     if (NULL != Window::HANDLE) ::DestroyWindow(Window::HANDLE);
     ::UnregisterClass(Window::CLASS_NAME, Program::HANDLE);
@@ -1,6 +1,10 @@
 /* Import --> gdi32.dll, kernel32.dll, shell32.dll, user32.dll */
 #include <stdint.h> // Standard Integer
+#include <cmath> // C Mathematics
+#include <climits> // C Limits
+#include <cstdio> // C Standard Input/ Output
 #include <cstdlib> // C Standard Library
+#include <cstring> // C String
 
 #include <windows.h> // Windows
 #include <windef.h> // Windows Definitions
@@ -24,29 +28,373 @@
 #   endif
 #endif
 
+template <unsigned char, unsigned char, unsigned char> struct Board;
+typedef Board<3u, 3u, 3u> TileBoard; // ->> Widen to e.g. `Board<15u, 15u, 5u>` for Gomoku
+
 static void Initiate(void);
 static void Update(void);
 
-inline void putPixel(unsigned short const, unsigned short const, DWORD const);
+static int benchmarkMain(char const[]);
+static uint32_t benchmarkRandom(void);
+static void benchmarkReport(char const[], unsigned long const, char const[], LARGE_INTEGER const, unsigned long const);
+
+inline unsigned short getTile(int const, int const);
+static int loopRun(MSG&, HANDLE const, bool (*const)(void), DWORD const, void (*const)(void));
+
+static DWORD WINAPI renderRun(LPVOID const);
+static bool renderStep(void);
+
+static DWORD WINAPI searchReply(LPVOID const);
+
+static DWORD WINAPI simulate(LPVOID const);
+static int simulatorMain(char const[]);
+static unsigned short simulatorMove(TileBoard&, bool const, unsigned char const, uint32_t&);
+
+static signed char solve(unsigned short const, unsigned short const);
+static void solveAll(std::size_t const, unsigned short const[], unsigned short const[], unsigned char[]);
+static void solverInitiate(void);
+
+static void blendPixel(UINT32&, DWORD const, float const);
+static void drawBevel(struct Framebuffer&, int const, int const, unsigned short const, unsigned char const, DWORD const, DWORD const);
+static void drawCoverageSpan(struct Framebuffer&, int const, float const, float const, DWORD const, bool const);
+static void drawLine(struct Framebuffer&, float const, float const, float const, float const, float const, DWORD const, bool const);
+static void drawRing(struct Framebuffer&, float const, float const, float const, float const, DWORD const, bool const);
+static void drawSprites(void);
+
+static LONG profilerCount(unsigned char const);
+static void profilerDraw(HDC const);
+static LONG profilerPercentile(unsigned char const, LONG const);
+static void profilerRecord(unsigned char const, LONGLONG const, LONGLONG const);
+static bool profilerSave(char const[]);
+
+/* Class > Board ->> `columnCount × rowCount` grid won by `length` marks in a row; Tile `n` is bit `n % 32` of word `n / 32` */
+template <unsigned char columnCount, unsigned char rowCount, unsigned char length>
+struct Board {
+    enum { COLUMN_COUNT = columnCount, LENGTH = length, ROW_COUNT = rowCount, TILE_COUNT = columnCount * rowCount, WORD_COUNT = ((columnCount * rowCount) + 31u) / 32u };
+    template <bool> struct Packed {}; // ->> Whether every tile fits one word; Picks a `matchWord(...)` overload at compile time, so larger boards never instantiate its 64-bit shifts
+    struct Search { // ->> Root moves shared out between `searchWorker` threads
+        Board const *board;
+        LONG volatile best; // ->> `pack(score, index)` of the best root move so far; Its score is also the shared alpha bound
+        bool crossing;
+        unsigned char depth;
+        LONG volatile next, nodes;
+        unsigned short count, tiles[TILE_COUNT];
+
+        static LONG pack(int const score, unsigned short const index) { return ((score + 0x4000L) << 16) | index; } // ->> Ordered by `score` alone, since `index` never reaches bit 16
+        static int unpackScore(LONG const best) { return static_cast<int>(best >> 16) - 0x4000; }
+        static unsigned short unpackIndex(LONG const best) { return best & 0xFFFFL; }
+    };
+
+    uint32_t crosses[WORD_COUNT], knots[WORD_COUNT], matches[WORD_COUNT];
+
+    Board(void) { for (unsigned short word = WORD_COUNT; word--; ) crosses[word] = knots[word] = matches[word] = 0u; }
+
+    // ...
+    static bool contains(uint32_t const marks[], int const column, int const row) {
+        return (column > -1 && column < columnCount) && (row > -1 && row < rowCount) && 0u != (marks[(column + (row * columnCount)) / 32u] & (1uL << ((column + (row * columnCount)) % 32u)));
+    }
+
+    unsigned short countMarks(void) const {
+        unsigned short count = 0u;
+
+        for (unsigned short word = WORD_COUNT; word--; )
+        for (uint32_t marks = crosses[word] | knots[word]; 0u != marks; marks &= marks - 1u) ++count;
+
+        return count;
+    }
+
+    bool isCrossed(unsigned short const tile) const { return 0u != (crosses[tile / 32u] & (1uL << (tile % 32u))); }
+    bool isKnotted(unsigned short const tile) const { return 0u != (knots[tile / 32u] & (1uL << (tile % 32u))); }
+    bool isMarked(unsigned short const tile) const { return isCrossed(tile) || isKnotted(tile); }
+    bool isMatched(unsigned short const tile) const { return 0u != (matches[tile / 32u] & (1uL << (tile % 32u))); }
+
+    // ... ->> Empty tiles worth searching: those within two steps of a mark (or the center of an empty board)
+    bool isCandidate(unsigned short const tile) const {
+        if (isMarked(tile)) return false;
+
+        for (int row = (tile / columnCount) - 2; row != static_cast<int>(tile / columnCount) + 3; ++row)
+        for (int column = (tile % columnCount) - 2; column != static_cast<int>(tile % columnCount) + 3; ++column)
+        if (contains(crosses, column, row) || contains(knots, column, row)) return true;
+
+        return tile == TILE_COUNT / 2u && 0u == countMarks();
+    }
+
+    void mark(unsigned short const tile, bool const crossing) { (crossing ? crosses : knots)[tile / 32u] |= 1uL << (tile % 32u); }
+    void unmark(unsigned short const tile) { crosses[tile / 32u] &= ~(1uL << (tile % 32u)); knots[tile / 32u] &= ~(1uL << (tile % 32u)); }
+
+    // ... ->> Only the 4 lines through `tile` can have just been completed; Optionally records the winning run(s) into `matches`
+    bool match(unsigned short const tile, bool const recorded) {
+        signed char const directions[4][2] = {{1, 0}, {0, 1}, {1, 1}, {1, -1}};
+        uint32_t const *const marks = isCrossed(tile) ? crosses : knots;
+        bool matched = false;
+
+        if (false == isMarked(tile)) return false;
+        if (1u == WORD_COUNT) return matchWord(tile, recorded, Packed<1u == WORD_COUNT>());
+
+        for (unsigned char direction = 4u; direction--; ) {
+            int const column = tile % columnCount, row = tile / columnCount;
+            int const columnDelta = directions[direction][0], rowDelta = directions[direction][1];
+            int first = 0, last = 0;
+
+            while (first - 1 > -static_cast<int>(length) && contains(marks, column + ((first - 1) * columnDelta), row + ((first - 1) * rowDelta))) --first;
+            while (last + 1 < static_cast<int>(length) && contains(marks, column + ((last + 1) * columnDelta), row + ((last + 1) * rowDelta))) ++last;
+
+            if (last - first >= static_cast<int>(length) - 1) {
+                matched = true;
+
+                if (recorded) for (int offset = first; offset <= last; ++offset)
+                matches[((column + (offset * columnDelta)) + ((row + (offset * rowDelta)) * columnCount)) / 32u] |= 1uL << (((column + (offset * columnDelta)) + ((row + (offset * rowDelta)) * columnCount)) % 32u);
+            }
+        }
+
+        return matched;
+    }
+
+    // ... ->> Single-word boards (up to 32 tiles, e.g. 3×3): shift-and-mask along each direction instead of walking tiles
+    //     `runs` narrows to the tiles starting `length` marks in a row, then is spread back over those runs; A direction counts if they cover `tile`
+    bool matchWord(unsigned short const, bool const, Packed<false>) { return false; }
+    bool matchWord(unsigned short const tile, bool const recorded, Packed<true>) {
+        uint64_t const firstColumn = ((static_cast<uint64_t>(1u) << TILE_COUNT) - 1u) / ((static_cast<uint64_t>(1u) << columnCount) - 1u); // ->> One bit per row
+        uint64_t const lastColumn = firstColumn << (columnCount - 1u);
+        uint64_t const masks[4] = {~lastColumn, ~static_cast<uint64_t>(0u), ~lastColumn, ~firstColumn}; // ->> Where each run may start without wrapping a row
+        uint64_t const marks = isCrossed(tile) ? crosses[0] : knots[0];
+        unsigned short const steps[4] = {1u, columnCount, columnCount + 1u, columnCount - 1u}; // ->> rightward, downward & both diagonals
+        bool matched = false;
+
+        for (unsigned char direction = 4u; direction--; ) {
+            uint64_t runs = marks, spread;
+
+            for (unsigned char step = length; --step; ) runs = marks & masks[direction] & (runs >> steps[direction]);
+            spread = runs;
+            for (unsigned char step = length; --step; ) spread |= (runs <<= steps[direction]);
+
+            if (0u != ((spread >> tile) & 1u)) {
+                if (false == recorded) return true;
+
+                matches[0] |= static_cast<uint32_t>(spread); // ->> A game ends on its first run, so every run here goes through `tile`
+                matched = true;
+            }
+        }
+
+        return matched;
+    }
+
+    // ... ->> Depth-limited negamax with alpha-beta pruning; Wins score higher the sooner they happen, unresolved lines score zero
+    int search(unsigned char const depth, bool const crossing, int alpha, int const beta, LONG &nodes) {
+        int best = -static_cast<int>(TILE_COUNT) - 1;
+        bool searched = false;
+
+        ++nodes;
+        if (0u == depth) return 0;
+
+        for (unsigned short tile = 0u; tile != TILE_COUNT && alpha < beta; ++tile)
+        if (isCandidate(tile)) {
+            int score;
+
+            mark(tile, crossing);
+            score = match(tile, false) ? static_cast<int>(TILE_COUNT) + 1 - countMarks() : -search(depth - 1u, false == crossing, -beta, -alpha, nodes);
+            unmark(tile);
+
+            searched = true;
+            if (best < score) best = score;
+            if (alpha < score) alpha = score;
+        }
+
+        return searched ? best : 0;
+    }
+
+    // ... ->> Splits the root moves across every processor; Returns the best tile or `TILE_COUNT` if there is none
+    unsigned short searchParallel(unsigned char const depth, bool const crossing, LONG *const nodes = NULL) const {
+        HANDLE threads[64];
+        DWORD threadCount = 0u;
+        SYSTEM_INFO systemInformation;
+        Search *const search = new Search();
+        unsigned short move = TILE_COUNT;
+
+        ::GetSystemInfo(&systemInformation);
+        search -> best = Search::pack(-static_cast<int>(TILE_COUNT) - 1, TILE_COUNT);
+        search -> board = this;
+        search -> count = 0u;
+        search -> crossing = crossing;
+        search -> depth = depth;
+        search -> next = 0;
+        search -> nodes = 0;
+
+        for (unsigned short tile = 0u; tile != TILE_COUNT; ++tile)
+        if (isCandidate(tile)) search -> tiles[search -> count++] = tile;
+
+        // ...
+        while (threadCount != systemInformation.dwNumberOfProcessors && threadCount != sizeof(threads) / sizeof(*threads) && threadCount != search -> count) {
+            threads[threadCount] = ::CreateThread(NULL, 0u, &Board::searchWorker, search, 0x0u, NULL);
+            if (NULL == threads[threadCount]) break;
+
+            ++threadCount;
+        }
+
+        if (0u == threadCount) searchWorker(search);
+        else {
+            ::WaitForMultipleObjects(threadCount, threads, TRUE, INFINITE);
+            while (threadCount--) ::CloseHandle(threads[threadCount]);
+        }
+
+        if (0u != search -> count) move = search -> tiles[Search::unpackIndex(search -> best)];
+        if (NULL != nodes) *nodes = search -> nodes;
+        delete search;
+
+        return move;
+    }
+
+    static DWORD WINAPI searchWorker(LPVOID const parameter) {
+        Search *const search = static_cast<Search*>(parameter);
+        Board board = *(search -> board);
+        LONG nodes = 0;
+
+        for (LONG index; (index = ::InterlockedIncrement(&search -> next) - 1) < search -> count; ) {
+            unsigned short const tile = search -> tiles[index];
+            LONG best = search -> best;
+            int score;
+
+            board.mark(tile, search -> crossing);
+            score = board.match(tile, false) ? static_cast<int>(TILE_COUNT) + 1 - board.countMarks() : -board.search(search -> depth - 1u, false == search -> crossing, -static_cast<int>(TILE_COUNT) - 1, -Search::unpackScore(best), nodes);
+            board.unmark(tile);
+
+            // ... ->> Raise the shared bound & take the move in one exchange; A score at or below the bound is only an upper bound (fail-low), so it is never taken
+            while (score > Search::unpackScore(best) && best != ::InterlockedCompareExchange(&search -> best, Search::pack(score, index), best)) best = search -> best;
+        }
+
+        ::InterlockedExchangeAdd(&search -> nodes, nodes);
+        return 0u;
+    }
+};
+
+/* Class > Framebuffer ->> Top-down view over 32-bit pixels; Bottom-up DIBs get a negative `stride` so rows are always addressed the same way */
+struct Framebuffer {
+    RECT clip; // ->> Writes outside are dropped; Checked once per span, never per pixel
+    int height;
+    UINT32 *memory; // ->> Top row
+    long stride; // ->> in pixels
+    int width;
+
+    Framebuffer(void) : clip(), height(0), memory(NULL), stride(0L), width(0) {}
+    Framebuffer(UINT32 memory[], long const stride, int const width, int const height) : clip(), height(height), memory(memory), stride(stride), width(width) { setClip(0, 0, width, height); }
+    Framebuffer(VOID *const bits, BITMAPINFOHEADER const &header) : clip(), height(header.biHeight < 0L ? -header.biHeight : header.biHeight), memory(static_cast<UINT32*>(bits)), stride(header.biHeight < 0L ? +header.biWidth : -header.biWidth), width(header.biWidth) {
+        if (header.biHeight > 0L) memory += (height - 1L) * header.biWidth; // ->> Bottom-up
+        setClip(0, 0, width, height);
+    }
+
+    UINT32* getRow(int const y) const { return memory + (y * stride); }
+
+    // ... ->> Copies a `sourceWidth × sourceHeight` image (rows `sourceStride` pixels apart) to `left`, `top`
+    void blit(int const left, int const top, UINT32 const source[], long const sourceStride, int const sourceWidth, int const sourceHeight) {
+        for (int y = top > clip.top ? top : clip.top; y < top + sourceHeight && y < clip.bottom; ++y)
+        write(y, left, source + ((y - top) * sourceStride), sourceWidth);
+    }
+
+    // ... ->> Fills pixels `[left, right)` of row `y`
+    void fill(int const y, int left, int right, UINT32 const pixel) {
+        if (y >= clip.top && y < clip.bottom) {
+            UINT32 *const row = getRow(y);
+
+            if (left < clip.left) left = clip.left;
+            if (right > clip.right) right = clip.right;
+            while (left < right) row[left++] = pixel;
+        }
+    }
+
+    void fill(int const left, int const top, int const right, int const bottom, UINT32 const pixel) {
+        for (int y = top > clip.top ? top : clip.top; y < bottom && y < clip.bottom; ++y)
+        fill(y, left, right, pixel);
+    }
+
+    // ... ->> Narrowed to the framebuffer bounds
+    void setClip(int const left, int const top, int const right, int const bottom) {
+        clip.bottom = bottom < height ? bottom : height;
+        clip.left = left > 0 ? left : 0;
+        clip.right = right < width ? right : width;
+        clip.top = top > 0 ? top : 0;
+    }
+
+    // ... ->> Copies `count` pixels to row `y` from `left`
+    void write(int const y, int left, UINT32 const source[], int const count) {
+        if (y >= clip.top && y < clip.bottom) {
+            int const right = left + count < clip.right ? left + count : clip.right;
+
+            if (left < clip.left) { source += clip.left - left; left = clip.left; }
+            if (left < right) std::memcpy(getRow(y) + left, source, (right - left) * sizeof(UINT32));
+        }
+    }
+};
 
 /* Global */
+// : Benchmark ->> Headless timings of the per-input & per-frame hot paths; Run with `--bench [count]`
+static uint32_t benchmarkSeed = 0x9E3779B9u; // ->> `benchmarkRandom()` state shared by every case, so runs are repeatable
+
 // : Console
 static HWND consoleWindowHandle = NULL;
 
 // : Game
 static bool gameEnded = false;
-
-// : Pointer
-static POINTS pointerCoordinates = POINTS();
-static bool pointerIsPressed = false;
+static bool volatile gameOpponentIsComputer = true; // ->> Knots are played by `solverMoves` (or `Board::searchParallel(...)` off 3×3 boards); Toggled with F2
+static LONG volatile gameReply = -1; // ->> Knot found by `searchReply(...)`, taken by the next `Update()`; `tiles.TILE_COUNT` if there was none, -1 if not yet found
+static bool gameSearching = false; // ->> A `searchReply(...)` is running; Marks are refused until its `gameReply` is taken
+
+// : Pointer ->> Written by the window thread, read by `Update()`
+static bool volatile pointerIsPressed = false;
+static unsigned short volatile pointerTile = USHRT_MAX; // ->> Index of the hovered tile; `tiles.TILE_COUNT` or more if none
+
+// : Profiler ->> Per-phase `Update()` timings; Toggled with F3 and exported as Chrome trace JSON with F5
+enum ProfilerPhase { profilerStatePhase, profilerBackgroundPhase, profilerTilesPhase, profilerPhaseCount };
+static struct ProfilerSample { LONGLONG duration, start; unsigned char phase; } profilerTrace[1024] = {};
+struct ProfilerTimer {
+    unsigned char phase;
+    LARGE_INTEGER start;
+
+    ProfilerTimer(unsigned char const);
+    ~ProfilerTimer(void);
+};
+static unsigned char const profilerBucketCount = 24u;
+static bool volatile profilerEnabled = false; // ->> Toggled with F3 on the window thread
+static LARGE_INTEGER profilerFrequency = LARGE_INTEGER();
+static LONG volatile profilerHistogram[profilerPhaseCount][profilerBucketCount] = {{0}}; // ->> Bucket `n` counts durations below 2ⁿ microseconds
+static char const *const profilerPhaseNames[profilerPhaseCount] = {"state", "background", "tiles"};
+static LONG volatile profilerTraceCount = 0;
+
+// : Render ->> `Update()` & the present run on `renderThread`, so the window thread only records input & raises `renderSignal`
+static bool volatile renderRunning = false;
+static HANDLE renderSignal = NULL; // ->> Auto-reset; Raised for a frame by the window thread & `searchReply(...)`
+static HANDLE renderThread = NULL; // ->> `NULL` if it could not be started, in which case `WM_PAINT` renders on the window thread
+
+// : Simulator ->> Headless self-play across every processor (or `threads` of them); Run with `--simulate [games] [cross policy] [knot policy] [threads]`
+enum SimulatorPolicy { simulatorRandomPolicy, simulatorGreedyPolicy, simulatorPerfectPolicy, simulatorPolicyCount };
+static char const *const simulatorPolicyNames[simulatorPolicyCount] = {"random", "greedy", "perfect"};
+static struct SimulatorStatistics { // ->> Written only by its own worker; Padded so neighbouring workers never share a cache line
+    unsigned long crossWins, draws, games, knotWins, lengths[TileBoard::TILE_COUNT + 1u];
+    unsigned char policies[2]; // ->> crosses, knots
+    uint32_t seed;
+    char padding[64];
+} *simulatorStatistics = NULL;
+
+// : Solver ->> Perfect play for every reachable board, indexed by `solverTernary[crosses] + 2 * solverTernary[knots]`
+static unsigned char solverMoves[19683] = {}; // ->> Best tile to mark; `9u` once the game is over, `0xFFu` if unsolved
+static unsigned char const solverPermutations[8][9] = { // ->> The 8 board symmetries (rotations & reflections) as tile permutations
+    {0u, 1u, 2u, 3u, 4u, 5u, 6u, 7u, 8u}, {6u, 3u, 0u, 7u, 4u, 1u, 8u, 5u, 2u}, {8u, 7u, 6u, 5u, 4u, 3u, 2u, 1u, 0u}, {2u, 5u, 8u, 1u, 4u, 7u, 0u, 3u, 6u},
+    {2u, 1u, 0u, 5u, 4u, 3u, 8u, 7u, 6u}, {6u, 7u, 8u, 3u, 4u, 5u, 0u, 1u, 2u}, {0u, 3u, 6u, 1u, 4u, 7u, 2u, 5u, 8u}, {8u, 5u, 2u, 7u, 4u, 1u, 6u, 3u, 0u}
+};
+static signed char solverScores[19683] = {}; // ->> Outcome for the player to move: positive wins, negative loses (sooner is larger in magnitude), zero draws
+static unsigned short solverSymmetries[8][512] = {}; // ->> `solverPermutations` applied to every 9-bit mask
+static unsigned short solverTernary[512] = {};
+
+// : Sprites ->> One pre-rendered `spriteSize × spriteSize` image (top-down) per tile appearance; Rebuilt by `drawSprites()` whenever `tileSize` changes
+enum SpriteKind { spriteEmpty, spriteCross, spriteKnot, spriteCrossMatched, spriteKnotMatched, spriteCount };
+static UINT32 *sprites = NULL;
+static unsigned short spriteSize = 0u;
 
 // : Tiles
-static struct Tile {
-    bool isCrossed, isKnotted;
-    bool isMatched;
-
-    Tile(void) : isCrossed(false), isKnotted(false) {}
-} *activeTile = NULL, tiles[9] = {};
+static TileBoard tiles = TileBoard();
+static unsigned short activeTile = USHRT_MAX; // ->> Index of the last marked tile; `tiles.TILE_COUNT` or more if none
+static unsigned char const tileSearchDepth = 4u; // ->> Plies searched by the computer off 3×3 boards
+static unsigned short const tileLines[8] = {0x007u, 0x038u, 0x1C0u, 0x049u, 0x092u, 0x124u, 0x111u, 0x054u}; // ->> rows, columns, diagonals (3×3 `solve(...)` only)
+static unsigned short tileMatchTable[512] = {}; // ->> Union of the `tileLines` fully contained by each mask
 static DWORD tileBevelColor = 0x000000u;
 static unsigned char tileBevelSize = 0u;
 static DWORD tileColor = 0x000000u;
@@ -54,6 +402,8 @@ static unsigned char tileMargin = 0u;
 static DWORD tileMatchColor = 0x000000u;
 static DWORD tileOutlineColor = 0x000000u;
 static unsigned short tileSize = 0u;
+static unsigned char tileStates[TileBoard::TILE_COUNT] = {}; // ->> `SpriteKind` last painted per tile, with bit 7 set while hover-lifted
+static LONG volatile tilesInvalid = 1; // ->> Repaint the whole frame (and every tile) on the next `Update()`, which clears it
 
 // : Window
 static WNDCLASSEX windowClassInformation = WNDCLASSEX();
@@ -63,34 +413,43 @@ static HWND windowHandle = NULL;
 static int windowHeight = 0, windowWidth = 0;
 static BITMAP windowMemoryDeviceContextBitmap = BITMAP();
 static VOID *windowMemoryDeviceContextBitmapBits = NULL;
+static Framebuffer windowFramebuffer = Framebuffer(); // ->> over `windowMemoryDeviceContextBitmapBits`
 static HBITMAP windowMemoryDeviceContextBitmapHandle = NULL;
 static HDC windowMemoryDeviceContextHandle = NULL;
 static LRESULT CALLBACK windowProcedure(HWND const windowHandle, UINT const message, WPARAM const messageParameter, LPARAM const messageSubparameter) {
     switch (message) {
         /* ... */
         case WM_CLOSE: ::DestroyWindow(windowHandle); break;
-        case WM_KEYDOWN: if (VK_ESCAPE == messageParameter) ::DestroyWindow(windowHandle); break;
+        case WM_KEYDOWN: switch (messageParameter) {
+            case VK_ESCAPE: ::DestroyWindow(windowHandle); break;
+            case VK_F2: gameOpponentIsComputer = false == gameOpponentIsComputer; break;
+            case VK_F3: profilerEnabled = false == profilerEnabled; ::InterlockedExchange(&tilesInvalid, 1); ::SetEvent(renderSignal); break;
+            case VK_F5: profilerSave("TicTacToeProfile.json"); break;
+        } break;
         case WM_SYSCOMMAND: if (SC_CLOSE == messageParameter) ::DestroyWindow(windowHandle); break;
         case WM_SYSKEYDOWN: if (VK_F4 == messageParameter) ::DestroyWindow(windowHandle); break;
 
         /* ... */
         case WM_LBUTTONDOWN: {
             if (false == pointerIsPressed) pointerIsPressed = true;
-            ::RedrawWindow(windowHandle, NULL, NULL, RDW_INTERNALPAINT | RDW_INVALIDATE);
+            ::SetEvent(renderSignal);
         } return EXIT_SUCCESS;
 
         case WM_LBUTTONUP: {
             pointerIsPressed = false;
-            ::RedrawWindow(windowHandle, NULL, NULL, RDW_INTERNALPAINT | RDW_INVALIDATE);
+            ::SetEvent(renderSignal);
         } return EXIT_SUCCESS;
 
         case WM_MOUSEMOVE: {
+            // ... ->> Repaint only once the pointer enters another tile
             if (false == pointerIsPressed) {
-                pointerCoordinates.x = GET_X_LPARAM(messageSubparameter);
-                pointerCoordinates.y = GET_Y_LPARAM(messageSubparameter);
-            }
+                unsigned short const tile = getTile(GET_X_LPARAM(messageSubparameter), GET_Y_LPARAM(messageSubparameter));
 
-            ::RedrawWindow(windowHandle, NULL, NULL, RDW_INTERNALPAINT | RDW_INVALIDATE);
+                if (pointerTile != tile) {
+                    pointerTile = tile;
+                    ::SetEvent(renderSignal);
+                }
+            }
         } return EXIT_SUCCESS;
 
         #ifdef WM_TOUCH
@@ -107,10 +466,9 @@ static LRESULT CALLBACK windowProcedure(HWND const windowHandle, UINT const mess
                 ::ScreenToClient(windowHandle, &touchCoordinates);
 
                 pointerIsPressed = true;
-                pointerCoordinates.x = touchCoordinates.x;
-                pointerCoordinates.y = touchCoordinates.y;
+                pointerTile = getTile(touchCoordinates.x, touchCoordinates.y);
 
-                ::RedrawWindow(windowHandle, NULL, NULL, RDW_INTERNALPAINT | RDW_INVALIDATE);
+                ::SetEvent(renderSignal);
             }
         } return EXIT_SUCCESS;
         #endif
@@ -149,6 +507,7 @@ static LRESULT CALLBACK windowProcedure(HWND const windowHandle, UINT const mess
 
             // ...
             ::GetObject(windowMemoryDeviceContextBitmapHandle, sizeof(BITMAP), &windowMemoryDeviceContextBitmap);
+            windowFramebuffer = Framebuffer(windowMemoryDeviceContextBitmapBits, windowMemoryDeviceContextBitmapInformation.bmiHeader);
             ::SelectObject(windowDeviceContextHandle, windowDeviceContextBitmapHandle);
             ::SelectObject(windowMemoryDeviceContextHandle, windowMemoryDeviceContextBitmapHandle);
 
@@ -163,11 +522,25 @@ static LRESULT CALLBACK windowProcedure(HWND const windowHandle, UINT const mess
 
             /* ... */
             Initiate();
+
+            // ... ->> Signalled up front for the first frame
+            renderRunning = true;
+            renderSignal = ::CreateEvent(NULL, FALSE, TRUE, NULL);
+            if (NULL != renderSignal) renderThread = ::CreateThread(NULL, 0u, &renderRun, NULL, 0x0u, NULL);
         } break;
 
         // ...
         case WM_DESTROY: {
+            renderRunning = false;
+            if (NULL != renderThread) {
+                ::SetEvent(renderSignal);
+                ::WaitForSingleObject(renderThread, INFINITE);
+                ::CloseHandle(renderThread);
+            }
+
+            if (NULL != renderSignal) ::CloseHandle(renderSignal);
             ::DeleteDC(windowMemoryDeviceContextHandle), ::DeleteObject(windowMemoryDeviceContextBitmapHandle);
+            std::free(sprites);
             ::ReleaseDC(windowHandle, windowDeviceContextHandle);
 
             ::PostQuitMessage(EXIT_SUCCESS);
@@ -175,12 +548,10 @@ static LRESULT CALLBACK windowProcedure(HWND const windowHandle, UINT const mess
 
         // ...
         case WM_PAINT: {
-            /* ... */
-            Update();
-
-            // ...
-            ::BitBlt(windowDeviceContextHandle, 0, 0, windowWidth, windowHeight, windowMemoryDeviceContextHandle, 0, 0, SRCCOPY);
             ::ValidateRect(windowHandle, NULL);
+
+            if (NULL != renderThread) ::SetEvent(renderSignal);
+            else renderStep();
         } return EXIT_SUCCESS;
     }
 
@@ -191,222 +562,877 @@ static LRESULT CALLBACK windowProcedure(HWND const windowHandle, UINT const mess
 /* Phase */
 // : Initiate
 void Initiate(void) {
-    int const windowMinimumSize = windowHeight < windowWidth ? windowHeight : windowWidth;
-
-    tileSize = ((windowMinimumSize / /* ->> column/ row count */ 3) * 3u) / 4u;
+    tileSize = (((windowWidth / tiles.COLUMN_COUNT < windowHeight / tiles.ROW_COUNT ? windowWidth / tiles.COLUMN_COUNT : windowHeight / tiles.ROW_COUNT)) * 3u) / 4u;
     tileOutlineColor = 0xA0A0A0u;
     tileMatchColor = 0x6FFF6Fu;
     tileMargin = 5u;
     tileColor = 0xF0F0F0u;
     tileBevelSize = (tileSize * 1u) / 20u;
     tileBevelColor = 0xC0C0C0u;
+    tilesInvalid = 1;
+
+    drawSprites();
+    ::QueryPerformanceFrequency(&profilerFrequency);
+
+    solverInitiate();
 }
 
 // : Update
 void Update(void) {
     if (false == gameEnded) {
-        unsigned short const tileBeveledSize = tileSize - tileBevelSize;
-        unsigned short const tilesSize = ((tileMargin * (3u - 1u)) + (tileSize * 3u));
-
-        unsigned short const horizontalOffset = (windowWidth - tilesSize) / 2u;
-        unsigned short const verticalOffset = (windowHeight - tilesSize) / 2u;
-
-        // ... ->> State
-        #if true
-            for (
-                int const combinations[] = {
-                    0, 1, 2,
-                    0, 3, 6,
-                    0, 4, 8,
-                    1, 4, 7,
-                    2, 4, 6,
-                    2, 5, 8,
-                    3, 4, 5,
-                    6, 7, 8
-                }, *iterator = combinations + ((sizeof(combinations) / sizeof(int)) - 3);
-                combinations <= iterator; iterator -= 3
-            ) if (
-                3 == (tiles[iterator[0]].isCrossed + tiles[iterator[1]].isCrossed + tiles[iterator[2]].isCrossed) ||
-                3 == (tiles[iterator[0]].isKnotted + tiles[iterator[1]].isKnotted + tiles[iterator[2]].isKnotted)
-            ) {
-                gameEnded = true;
-
-                tiles[iterator[0]].isMatched = true;
-                tiles[iterator[1]].isMatched = true;
-                tiles[iterator[2]].isMatched = true;
+        bool const pressed = pointerIsPressed;
+        unsigned short const hovered = pointerTile;
+        unsigned short const tilesHeight = ((tileMargin * (tiles.ROW_COUNT - 1u)) + (tileSize * tiles.ROW_COUNT));
+        unsigned short const tilesWidth = ((tileMargin * (tiles.COLUMN_COUNT - 1u)) + (tileSize * tiles.COLUMN_COUNT));
+
+        unsigned short const horizontalOffset = (windowWidth - tilesWidth) / 2u;
+        unsigned short const verticalOffset = (windowHeight - tilesHeight) / 2u;
+
+        /* ... ->> State ->> `tiles.matches` is filled in by `Board::match(...)` as each mark lands */ {
+            ProfilerTimer const timer(profilerStatePhase);
+            LONG const reply = ::InterlockedExchange(&gameReply, -1);
+
+            // ... ->> computer reply
+            if (-1 != reply) {
+                gameSearching = false;
+
+                if (static_cast<unsigned short>(reply) < tiles.TILE_COUNT && false == tiles.isMarked(static_cast<unsigned short>(reply))) {
+                    tiles.mark(static_cast<unsigned short>(reply), false);
+                    tiles.match(activeTile = static_cast<unsigned short>(reply), true);
+                }
             }
-        #else
-            bool horizontalMatch = false, verticalMatch = false;
-            bool leadingDiagonalMatch = false, trailingDiagonalMatch = false;
-
-            {
-                // ... ->> horizontal
-                if (false == (horizontalMatch || leadingDiagonalMatch || trailingDiagonalMatch || verticalMatch))
-                for (unsigned char row = 3u; row--; ) {
-                    horizontalMatch = true;
-
-                    for (unsigned char column = 3u; --column && horizontalMatch; )
-                    horizontalMatch = (
-                        2 == tiles[column + (row * 3u)].isCrossed + tiles[(column - 1u) + (row * 3u)].isCrossed ||
-                        2 == tiles[column + (row * 3u)].isKnotted + tiles[(column - 1u) + (row * 3u)].isKnotted
-                    );
-
-                    if (horizontalMatch) {
-                        for (unsigned char column = 3u; column--; ) tiles[column + (row * 3u)].isMatched = true;
-                        gameEnded = true; break;
+
+            // ... ->> player tile select
+            if (pressed && false == gameSearching && hovered < tiles.TILE_COUNT && false == tiles.isMarked(hovered)) {
+                tiles.mark(hovered, false == (activeTile < tiles.TILE_COUNT && tiles.isCrossed(activeTile)));
+                activeTile = hovered;
+
+                // ... ->> Computer reply; One table lookup on 3×3 boards, otherwise a parallel search off the window thread
+                if (gameOpponentIsComputer && tiles.isCrossed(activeTile) && false == tiles.match(activeTile, true)) {
+                    if (3u == tiles.COLUMN_COUNT && 3u == tiles.ROW_COUNT && 3u == tiles.LENGTH) {
+                        unsigned short const move = solverMoves[solverTernary[tiles.crosses[0] & 0x1FFu] + (2u * solverTernary[tiles.knots[0] & 0x1FFu])];
+
+                        if (tiles.TILE_COUNT > move) {
+                            tiles.mark(move, false);
+                            activeTile = move;
+                        }
+                    }
+
+                    else {
+                        TileBoard *const board = new TileBoard(tiles);
+                        HANDLE const thread = ::CreateThread(NULL, 0u, &searchReply, board, 0x0u, NULL);
+
+                        gameSearching = true;
+                        if (NULL == thread) searchReply(board);
+                        else ::CloseHandle(thread);
                     }
                 }
 
-                // ... ->> leading diagonal
-                if (false == (horizontalMatch || leadingDiagonalMatch || trailingDiagonalMatch || verticalMatch)) {
-                    leadingDiagonalMatch = true;
+                tiles.match(activeTile, true);
+            }
+
+            for (unsigned short word = tiles.WORD_COUNT; word--; )
+            gameEnded = gameEnded || 0u != tiles.matches[word];
+        }
 
-                    for (unsigned char column = 3u, row = 3u; leadingDiagonalMatch && (--column && --row); )
-                    leadingDiagonalMatch = (
-                        2 == tiles[column + (row * 3u)].isCrossed + tiles[(column - 1u) + ((row - 1u) * 3u)].isCrossed ||
-                        2 == tiles[column + (row * 3u)].isKnotted + tiles[(column - 1u) + ((row - 1u) * 3u)].isKnotted
-                    );
+        /* ... ->> Rendering (background) ->> Only after `tilesInvalid` is raised; Tiles otherwise repaint their own cells */ {
+            ProfilerTimer const timer(profilerBackgroundPhase);
 
-                    if (leadingDiagonalMatch) {
-                        gameEnded = true;
+            if (0 != ::InterlockedExchange(&tilesInvalid, 0)) {
+                windowFramebuffer.fill(0, 0, windowFramebuffer.width, windowFramebuffer.height, (0xFFu << 0x18u) | 0x000000u);
+                windowFramebuffer.fill(horizontalOffset - (tileMargin / 2u), verticalOffset - (tileMargin / 2u), (horizontalOffset + tilesWidth) - (tileMargin / 2u) + tileMargin, (verticalOffset + tilesHeight) - (tileMargin / 2u) + tileMargin, (0xFFu << 0x18u) | 0x333333u);
 
-                        for (unsigned char column = 3u, row = 3u; column-- && row--; )
-                        tiles[column + (row * 3u)].isMatched = true;
-                    }
-                }
+                for (unsigned short tile = tiles.TILE_COUNT; tile--; ) tileStates[tile] = 0xFFu;
+            }
+        }
 
-                // ... ->> trailing diagonal
-                if (false == (horizontalMatch || leadingDiagonalMatch || trailingDiagonalMatch || verticalMatch)) {
-                    trailingDiagonalMatch = true;
+        /* ... ->> Rendering (tiles) ->> Copies cached sprites for tiles whose mark, match or hover changed since the last paint */ {
+            ProfilerTimer const timer(profilerTilesPhase);
 
-                    for (unsigned char column = 0u, row = 3u; trailingDiagonalMatch && --row; ++column)
-                    trailingDiagonalMatch = (
-                        2 == tiles[column + (row * 3u)].isCrossed + tiles[(column + 1u) + ((row - 1u) * 3u)].isCrossed ||
-                        2 == tiles[column + (row * 3u)].isKnotted + tiles[(column + 1u) + ((row - 1u) * 3u)].isKnotted
-                    );
+            for (unsigned short iterator = tiles.TILE_COUNT; iterator--; ) {
+                unsigned char const lifted = iterator == hovered && false == pressed ? tileMargin / 2u : 0u;
+                unsigned short const left = horizontalOffset + ((iterator % tiles.COLUMN_COUNT) * (tileSize + tileMargin));
+                unsigned short const top = verticalOffset + ((iterator / tiles.COLUMN_COUNT) * (tileSize + tileMargin));
+                unsigned char const state = (
+                    tiles.isCrossed(iterator) ? (tiles.isMatched(iterator) ? spriteCrossMatched : spriteCross) :
+                    tiles.isKnotted(iterator) ? (tiles.isMatched(iterator) ? spriteKnotMatched : spriteKnot) :
+                    spriteEmpty
+                ) | (lifted ? 0x80u : 0x00u);
 
-                    if (trailingDiagonalMatch) {
-                        gameEnded = true;
+                // ...
+                if (state != tileStates[iterator]) {
+                    UINT32 const *const sprite = sprites + ((state & 0x7Fu) * spriteSize * spriteSize);
 
-                        for (unsigned char column = 0u, row = 3u; row--; ++column)
-                        tiles[column + (row * 3u)].isMatched = true;
-                    }
+                    windowFramebuffer.fill(left - (tileMargin / 2u), top - (tileMargin / 2u), (left + tileSize) - (tileMargin / 2u) + tileMargin, (top + tileSize) - (tileMargin / 2u) + tileMargin, (0xFFu << 0x18u) | 0x333333u);
+                    windowFramebuffer.blit(left, top - lifted, sprite, spriteSize, spriteSize, spriteSize);
+
+                    tileStates[iterator] = state;
                 }
+            }
+        }
+    }
+}
 
-                // ... ->> vertical
-                if (false == (horizontalMatch || leadingDiagonalMatch || trailingDiagonalMatch || verticalMatch))
-                for (unsigned char column = 3u; column--; ) {
-                    verticalMatch = true;
+/* Function > Benchmark ... */
+int benchmarkMain(char const commandLineArguments[]) {
+    unsigned long count = 1000000uL;
+    LARGE_INTEGER start;
 
-                    for (unsigned char row = 3u; --row && verticalMatch; )
-                    verticalMatch = (
-                        2 == tiles[column + (row * 3u)].isCrossed + tiles[column + ((row - 1u) * 3u)].isCrossed ||
-                        2 == tiles[column + (row * 3u)].isKnotted + tiles[column + ((row - 1u) * 3u)].isKnotted
-                    );
+    std::sscanf(std::strstr(commandLineArguments, "--bench") + 7, "%lu", &count);
+    std::printf("%lu per case\n", count);
 
-                    if (verticalMatch) {
-                        for (unsigned char row = 3u; row--; ) tiles[column + (row * 3u)].isMatched = true;
-                        gameEnded = true; break;
-                    }
-                }
+    // ... ->> A 1024×768 window, drawn into memory instead of a DIB section
+    windowHeight = 768;
+    windowWidth = 1024;
+    windowMemoryDeviceContextBitmapBits = std::malloc(windowWidth * windowHeight * sizeof(UINT32));
+    if (NULL == windowMemoryDeviceContextBitmapBits) return EXIT_FAILURE;
+
+    windowFramebuffer = Framebuffer(static_cast<UINT32*>(windowMemoryDeviceContextBitmapBits), windowWidth, windowWidth, windowHeight);
+    Initiate();
+
+    /* ... ->> Hit testing ->> A pointer trace of short random steps; Counts the tile changes that would repaint */ {
+        unsigned short hovered = tiles.TILE_COUNT;
+        unsigned long repaints = 0uL;
+        int x = windowWidth / 2, y = windowHeight / 2;
+
+        ::QueryPerformanceCounter(&start);
+        for (unsigned long point = count; point--; ) {
+            uint32_t const step = benchmarkRandom();
+            unsigned short tile;
+
+            x = (x + windowWidth + static_cast<int>(step % 33u) - 16) % windowWidth;
+            y = (y + windowHeight + static_cast<int>((step >> 8u) % 33u) - 16) % windowHeight;
+
+            tile = getTile(x, y);
+            if (hovered != tile) { hovered = tile; ++repaints; }
+        }
+
+        benchmarkReport("hit test", count, "points", start, repaints);
+    }
+
+    /* ... ->> Win detection ->> `Board::match(...)` through the last mark of random part-filled boards, then the 3×3 `tileMatchTable` lookup */ {
+        static TileBoard boards[1024];
+        static unsigned short lastTiles[1024];
+        unsigned long wins = 0uL;
+
+        for (unsigned short board = 0u; board != 1024u; ++board) {
+            boards[board] = TileBoard();
+
+            for (unsigned short mark = 0u; mark != tiles.TILE_COUNT / 2u; ++mark) {
+                unsigned short const tile = benchmarkRandom() % tiles.TILE_COUNT;
+                if (false == boards[board].isMarked(tile)) boards[board].mark(tile, 0u != mark % 2u);
             }
-        #endif
 
-        // ... ->> Rendering
-        for (unsigned short x = tilesSize + tileMargin; x--; )
-        for (unsigned short y = tilesSize + tileMargin; y--; ) {
-            putPixel((horizontalOffset + x) - (tileMargin / 2u), (verticalOffset + y) - (tileMargin / 2u), 0x333333u);
+            do lastTiles[board] = benchmarkRandom() % tiles.TILE_COUNT;
+            while (boards[board].isMarked(lastTiles[board]));
+            boards[board].mark(lastTiles[board], true);
         }
 
-        for (unsigned char iterator = sizeof(tiles) / sizeof(*tiles); iterator--; ) {
-            unsigned short const left = horizontalOffset + ((iterator % /* ->> column/ row count */ 3u) * (tileSize + (iterator ? tileMargin : 0u)));
-            unsigned short top = verticalOffset + ((iterator / /* ->> column/ row count */ 3u) * (tileSize + (iterator ? tileMargin : 0u)));
+        ::QueryPerformanceCounter(&start);
+        for (unsigned long test = count; test--; ) wins += boards[test % 1024u].match(lastTiles[test % 1024u], false);
+        benchmarkReport("match", count, "tests", start, wins);
 
-            // ... ->> player tile select
-            if (
-                (left < pointerCoordinates.x && pointerCoordinates.x < (left + tileSize)) &&
-                (top < pointerCoordinates.y && pointerCoordinates.y < (top + tileSize))
-            ) {
-                if (false == pointerIsPressed) top -= tileMargin / 2u;
-                else {
-                    if (NULL == activeTile) (tiles + iterator) -> isCrossed = true;
-                    else if (activeTile != tiles + iterator) {
-                        if (activeTile -> isCrossed) (tiles + iterator) -> isKnotted = true;
-                        if (activeTile -> isKnotted) (tiles + iterator) -> isCrossed = true;
-                    }
+        wins = 0uL;
+        ::QueryPerformanceCounter(&start);
+        for (unsigned long test = count; test--; ) wins += 0x000u != tileMatchTable[boards[test % 1024u].crosses[0] & 0x1FFu];
+        benchmarkReport("match table", count, "tests", start, wins);
+    }
+
+    /* ... ->> Solver queries ->> `solveAll(...)` over batches of random 3×3 boards with crosses moving first */ {
+        static unsigned short crosses[4096], knots[4096];
+        static unsigned char moves[4096];
+        unsigned long checksum = 0uL, queries = 0uL;
+
+        for (unsigned short query = 0u; query != 4096u; ++query) {
+            unsigned char const marks = benchmarkRandom() % 9u;
 
-                    activeTile = tiles + iterator;
+            crosses[query] = knots[query] = 0x000u;
+            for (unsigned char mark = 0u; mark != marks; ) {
+                unsigned short const tile = 1u << (benchmarkRandom() % 9u);
+
+                if (0x000u == ((crosses[query] | knots[query]) & tile)) {
+                    (0u == mark % 2u ? crosses : knots)[query] |= tile;
+                    ++mark;
                 }
             }
+        }
 
-            // ... ->> base fill
-            for (unsigned short x = tileSize; x--; )
-            for (unsigned short y = tileSize; y--; ) {
-                putPixel(left + x, top + y, (
-                    (x > tileBeveledSize && y >= tileBevelSize) || // ->> edge (right)
-                    ((x > tileBeveledSize && y < tileBevelSize) && (x - tileBeveledSize >= tileBevelSize - y)) || // ->> corner
+        ::QueryPerformanceCounter(&start);
+        for (; queries < count; queries += 4096u) {
+            solveAll(4096u, crosses, knots, moves);
+            checksum += moves[queries % 4096u];
+        }
+
+        benchmarkReport("solver", queries, "queries", start, checksum);
+    }
 
-                    (x >= tileBevelSize && y > tileBeveledSize) || // ->> edge (bottom)
-                    ((y > tileBeveledSize && x < tileBevelSize) && (y - tileBeveledSize >= tileBevelSize - x)) // ->> corner
-                ) ? tileBevelColor : ((tiles + iterator) -> isMatched ? tileMatchColor : tileColor));
+    /* ... ->> Search ->> `Board::searchParallel(...)` at `tileSearchDepth` from random two-mark openings; Reported per position visited */ {
+        unsigned long checksum = 0uL, positions = 0uL;
+
+        ::QueryPerformanceCounter(&start);
+        for (unsigned long search = count / 1000uL + 1uL; search--; ) {
+            TileBoard board = TileBoard();
+            LONG nodes = 0;
+
+            for (unsigned char mark = 0u; mark != 2u; ) {
+                unsigned short const tile = benchmarkRandom() % tiles.TILE_COUNT;
+                if (false == board.isMarked(tile)) board.mark(tile, 0u == mark++);
             }
 
-            // ... ->> bevel outline
-            for (unsigned short x = tileBevelSize; tileBeveledSize != x; ++x) {
-                putPixel(left + x, top + tileBevelSize, tileOutlineColor);
-                putPixel(left + x, top + tileBeveledSize, tileOutlineColor);
+            checksum += board.searchParallel(tileSearchDepth, true, &nodes);
+            positions += nodes;
+        }
+
+        benchmarkReport("search", positions, "positions", start, checksum);
+    }
+
+    /* ... ->> Gomoku ->> `match(...)` & `searchParallel(...)` as above on a 15×15 board won by 5 in a row, which walks its lines tile by tile instead */ {
+        typedef Board<15u, 15u, 5u> GomokuBoard;
+        static GomokuBoard boards[256];
+        static unsigned short lastTiles[256];
+        unsigned long checksum = 0uL, positions = 0uL, wins = 0uL;
+
+        for (unsigned short board = 0u; board != 256u; ++board) {
+            boards[board] = GomokuBoard();
+
+            for (unsigned short mark = 0u; mark != GomokuBoard::TILE_COUNT / 2u; ++mark) {
+                unsigned short const tile = benchmarkRandom() % GomokuBoard::TILE_COUNT;
+                if (false == boards[board].isMarked(tile)) boards[board].mark(tile, 0u != mark % 2u);
             }
 
-            for (unsigned short y = tileBevelSize; tileBeveledSize != y; ++y) {
-                putPixel(left + tileBevelSize, top + y, tileOutlineColor);
-                putPixel(left + tileBeveledSize, top + y, tileOutlineColor);
+            do lastTiles[board] = benchmarkRandom() % GomokuBoard::TILE_COUNT;
+            while (boards[board].isMarked(lastTiles[board]));
+            boards[board].mark(lastTiles[board], true);
+        }
+
+        ::QueryPerformanceCounter(&start);
+        for (unsigned long test = count; test--; ) wins += boards[test % 256u].match(lastTiles[test % 256u], false);
+        benchmarkReport("gomoku match", count, "tests", start, wins);
+
+        ::QueryPerformanceCounter(&start);
+        for (unsigned long search = count / 10000uL + 1uL; search--; ) {
+            GomokuBoard board = GomokuBoard();
+            LONG nodes = 0;
+
+            for (unsigned char mark = 0u; mark != 2u; ) {
+                unsigned short const tile = ((5u + (benchmarkRandom() % 5u)) * GomokuBoard::COLUMN_COUNT) + 5u + (benchmarkRandom() % 5u); // ->> Near the center, as a game opens
+                if (false == board.isMarked(tile)) board.mark(tile, 0u == mark++);
             }
 
-            /* ... */
-            if ((tiles + iterator) -> isCrossed) {
-                unsigned char const crossThickness = 10u;
-                unsigned char const crossSize = (tileBeveledSize * 3u) / 5u;
-                unsigned char const crossOffset = (tileBeveledSize - crossSize) / 2u;
-                DWORD const crossColor = 0x0060FFu;
+            checksum += board.searchParallel(3u, true, &nodes);
+            positions += nodes;
+        }
 
-                // ...
-                for (unsigned short x = crossSize, y = crossSize; x-- && y--; )
-                for (short thickness = -(static_cast<short>(crossThickness) / 2); thickness != (crossThickness / 2u); ++thickness) {
-                    putPixel(crossOffset + left + x, static_cast<short>(crossOffset + top + y) + thickness, crossColor);
-                    putPixel(crossOffset + left + (crossSize - x), static_cast<short>(crossOffset + top + y) + thickness, crossColor);
-                }
+        benchmarkReport("gomoku search", positions, "positions", start, checksum);
+    }
+
+    /* ... ->> Painting ->> `Update()` repainting every tile, then only the two a hover moving between them changes */ {
+        unsigned long const frames = count / 1000uL + 1uL;
+
+        tiles.mark(0u, true);
+        tiles.mark(tiles.TILE_COUNT - 1u, false);
+
+        ::QueryPerformanceCounter(&start);
+        for (unsigned long frame = frames; frame--; ) { tilesInvalid = 1; Update(); }
+        benchmarkReport("full paint", frames, "frames", start, windowFramebuffer.getRow(windowHeight / 2)[windowWidth / 2]);
+
+        ::QueryPerformanceCounter(&start);
+        for (unsigned long frame = frames; frame--; ) { pointerTile = frame % tiles.TILE_COUNT; Update(); }
+        benchmarkReport("hover paint", frames, "frames", start, windowFramebuffer.getRow(windowHeight / 2)[windowWidth / 2]);
+
+        tiles = TileBoard();
+    }
+
+    /* ... ->> Rasterizing ->> Antialiased lines & rings at random over the window, then every sprite rebuilt at `tileSize` */ {
+        unsigned long const shapes = count / 100uL + 1uL;
+
+        ::QueryPerformanceCounter(&start);
+        for (unsigned long shape = shapes; shape--; ) {
+            uint32_t const begin = benchmarkRandom(), end = benchmarkRandom();
+            drawLine(windowFramebuffer, begin % windowWidth, (begin >> 16u) % windowHeight, end % windowWidth, (end >> 16u) % windowHeight, 10.0f, 0x0060FFu, true);
+        }
+        benchmarkReport("line", shapes, "lines", start, windowFramebuffer.getRow(windowHeight / 2)[windowWidth / 2]);
+
+        ::QueryPerformanceCounter(&start);
+        for (unsigned long shape = shapes; shape--; ) {
+            uint32_t const center = benchmarkRandom();
+            drawRing(windowFramebuffer, center % windowWidth, (center >> 16u) % windowHeight, 80.0f, 70.0f, 0xFF300Fu, true);
+        }
+        benchmarkReport("ring", shapes, "rings", start, windowFramebuffer.getRow(windowHeight / 2)[windowWidth / 2]);
+
+        ::QueryPerformanceCounter(&start);
+        for (unsigned long set = count / 10000uL + 1uL; set--; ) drawSprites();
+        benchmarkReport("sprites", count / 10000uL + 1uL, "sets", start, NULL == sprites ? 0u : sprites[(spriteSize * spriteSize) / 2u]);
+    }
+
+    /* ... ->> Framebuffer ->> Clipped sprite blits & span fills at random, through a top-down view and then a bottom-up (negative stride) one */ {
+        BITMAPINFOHEADER header = BITMAPINFOHEADER();
+        unsigned long const operations = count / 100uL + 1uL;
+
+        header.biHeight = windowHeight;
+        header.biWidth = windowWidth;
+
+        for (unsigned char view = 0u; view != 2u; ++view) {
+            Framebuffer framebuffer = 0u == view ? windowFramebuffer : Framebuffer(windowMemoryDeviceContextBitmapBits, header);
+
+            ::QueryPerformanceCounter(&start);
+            for (unsigned long operation = operations; operation--; ) {
+                uint32_t const position = benchmarkRandom();
+                framebuffer.blit(static_cast<int>(position % (windowWidth + spriteSize)) - spriteSize, static_cast<int>((position >> 16u) % (windowHeight + spriteSize)) - spriteSize, sprites, spriteSize, spriteSize, spriteSize);
             }
+            benchmarkReport(0u == view ? "blit" : "blit (flip)", operations, "blits", start, framebuffer.getRow(windowHeight / 2)[windowWidth / 2]);
 
-            if ((tiles + iterator) -> isKnotted) {
-                unsigned char const knotCenter = tileSize / 2;
-                DWORD const knotColor = 0xFF300Fu;
-                unsigned char const knotRadius = ((tileBeveledSize * 3u) / 5u) / /* ->> because radius */ 2u;
-                unsigned char const knotThickness = 10u;
+            ::QueryPerformanceCounter(&start);
+            for (unsigned long operation = operations; operation--; ) {
+                uint32_t const position = benchmarkRandom();
+                framebuffer.fill(static_cast<int>(position % windowWidth) - 64, static_cast<int>((position >> 16u) % windowHeight) - 64, static_cast<int>(position % windowWidth) + 64, static_cast<int>((position >> 16u) % windowHeight) + 64, (0xFFu << 0x18u) | (position & 0xFFFFFFu));
+            }
+            benchmarkReport(0u == view ? "fill" : "fill (flip)", operations, "fills", start, framebuffer.getRow(windowHeight / 2)[windowWidth / 2]);
+        }
+    }
 
-                // ...
-                for (unsigned short x = tileSize; x--; )
-                for (unsigned short y = tileSize; y--; ) {
-                    unsigned short const xDelta = x > knotCenter ? x - knotCenter : (knotCenter - x);
-                    unsigned short const yDelta = y > knotCenter ? y - knotCenter : (knotCenter - y);
-                    int const delta = (knotRadius * knotRadius) - ((xDelta * xDelta) + (yDelta * yDelta));
-
-                    // ...
-                    if ((knotRadius * knotThickness) > (delta < 0 ? -delta : delta))
-                    putPixel(left + x, top + y, knotColor);
-                }
+    std::free(sprites);
+    std::free(windowMemoryDeviceContextBitmapBits);
+
+    return EXIT_SUCCESS;
+}
+
+// ... ->> xorshift32
+uint32_t benchmarkRandom(void) {
+    benchmarkSeed ^= benchmarkSeed << 13u; benchmarkSeed ^= benchmarkSeed >> 17u; benchmarkSeed ^= benchmarkSeed << 5u;
+    return benchmarkSeed;
+}
+
+// ... ->> Rate since `start`, plus a checksum of the work so none of it is optimized out
+void benchmarkReport(char const name[], unsigned long const count, char const unit[], LARGE_INTEGER const start, unsigned long const checksum) {
+    LARGE_INTEGER end, frequency;
+    double seconds;
+
+    ::QueryPerformanceCounter(&end);
+    ::QueryPerformanceFrequency(&frequency);
+    seconds = static_cast<double>(end.QuadPart - start.QuadPart) / static_cast<double>(frequency.QuadPart);
+
+    std::printf("%-12s %10lu %s in %.3f s (%.0f %s/s, checksum %lu)\n", name, count, unit, seconds, 0.0 != seconds ? count / seconds : 0.0, unit, checksum);
+}
+
+/* Function > Draw ... ->> Span rasterizer; Every primitive reduces to `Framebuffer::fill(...)` spans, clipped once each */
+void drawBevel(Framebuffer &framebuffer, int const left, int const top, unsigned short const size, unsigned char const bevel, DWORD const faceColor, DWORD const bevelColor) {
+    unsigned short const beveledSize = size - bevel;
+
+    // ... ->> Face then bevel as one span each per row; The bevel runs down the right & bottom edges with 45° corners
+    for (unsigned short y = 0u; y != size; ++y) {
+        int const split = y < bevel ? beveledSize + (bevel - y) : (y > beveledSize ? (y - beveledSize < bevel ? bevel - (y - beveledSize) : 0) : beveledSize + 1);
+
+        framebuffer.fill(top + y, left, left + (split < size ? split : size), (0xFFu << 0x18u) | faceColor);
+        framebuffer.fill(top + y, left + split, left + size, (0xFFu << 0x18u) | bevelColor);
+    }
+}
+
+void drawLine(Framebuffer &framebuffer, float const beginX, float const beginY, float const endX, float const endY, float const thickness, DWORD const color, bool const antialiased) {
+    float const length = std::sqrt(((endX - beginX) * (endX - beginX)) + ((endY - beginY) * (endY - beginY)));
+    float const normalX = 0.0f != length ? (-(endY - beginY) * thickness) / (2.0f * length) : 0.0f;
+    float const normalY = 0.0f != length ? ((endX - beginX) * thickness) / (2.0f * length) : 0.0f;
+    float const corners[4][2] = {{beginX + normalX, beginY + normalY}, {endX + normalX, endY + normalY}, {endX - normalX, endY - normalY}, {beginX - normalX, beginY - normalY}};
+    float bottom = corners[0][1], top = corners[0][1];
+
+    for (unsigned char corner = 4u; corner--; ) {
+        if (bottom < corners[corner][1]) bottom = corners[corner][1];
+        if (top > corners[corner][1]) top = corners[corner][1];
+    }
+
+    // ... ->> The line is a convex quadrilateral; Each scanline crosses exactly two of its edges
+    for (int y = static_cast<int>(std::floor(top)) > 0 ? static_cast<int>(std::floor(top)) : 0; y < framebuffer.height && y <= bottom; ++y) {
+        float const center = y + 0.5f;
+        float left = 0.0f, right = 0.0f;
+        bool crossed = false;
+
+        for (unsigned char corner = 4u; corner--; ) {
+            float const *const from = corners[corner];
+            float const *const to = corners[(corner + 1u) % 4u];
+
+            if ((from[1] <= center && center < to[1]) || (to[1] <= center && center < from[1])) {
+                float const x = from[0] + (((center - from[1]) * (to[0] - from[0])) / (to[1] - from[1]));
+
+                if (false == crossed || left > x) left = x;
+                if (false == crossed || right < x) right = x;
+                crossed = true;
             }
         }
+
+        if (crossed) drawCoverageSpan(framebuffer, y, left, right, color, antialiased);
     }
 }
 
-/* Function > Put Pixel */
-void putPixel(unsigned short const x, unsigned short const y, DWORD const color) { static_cast<UINT32*>(windowMemoryDeviceContextBitmapBits)[x + (windowMemoryDeviceContextBitmap.bmWidth * (windowMemoryDeviceContextBitmap.bmHeight - y - 1L))] = color | (0xFFu << 0x18u); }
+void drawRing(Framebuffer &framebuffer, float const centerX, float const centerY, float const outerRadius, float const innerRadius, DWORD const color, bool const antialiased) {
+    // ... ->> One or two spans per scanline, bounded by the outer & inner circles
+    for (int y = static_cast<int>(std::floor(centerY - outerRadius)) > 0 ? static_cast<int>(std::floor(centerY - outerRadius)) : 0; y < framebuffer.height && y <= centerY + outerRadius; ++y) {
+        float const delta = (y + 0.5f) - centerY;
+
+        if (delta * delta < outerRadius * outerRadius) {
+            float const outer = std::sqrt((outerRadius * outerRadius) - (delta * delta));
+
+            if (delta * delta < innerRadius * innerRadius) {
+                float const inner = std::sqrt((innerRadius * innerRadius) - (delta * delta));
+
+                drawCoverageSpan(framebuffer, y, centerX - outer, centerX - inner, color, antialiased);
+                drawCoverageSpan(framebuffer, y, centerX + inner, centerX + outer, color, antialiased);
+            }
+
+            else drawCoverageSpan(framebuffer, y, centerX - outer, centerX + outer, color, antialiased);
+        }
+    }
+}
+
+// ... ->> Fills the continuous range `[left, right)` of row `y`; Partially covered end pixels are blended by coverage when `antialiased`
+void drawCoverageSpan(Framebuffer &framebuffer, int const y, float const left, float const right, DWORD const color, bool const antialiased) {
+    if (false == antialiased) framebuffer.fill(y, static_cast<int>(std::floor(left + 0.5f)), static_cast<int>(std::floor(right + 0.5f)), (0xFFu << 0x18u) | color);
+    else if (y >= framebuffer.clip.top && y < framebuffer.clip.bottom && left < right) {
+        int const first = static_cast<int>(std::floor(left)), last = static_cast<int>(std::floor(right));
+        UINT32 *const row = framebuffer.getRow(y);
+
+        if (first == last) { if (first >= framebuffer.clip.left && first < framebuffer.clip.right) blendPixel(row[first], color, right - left); }
+        else {
+            if (first >= framebuffer.clip.left && first < framebuffer.clip.right) blendPixel(row[first], color, (first + 1) - left);
+            if (last >= framebuffer.clip.left && last < framebuffer.clip.right) blendPixel(row[last], color, right - last);
+
+            framebuffer.fill(y, first + 1, last, (0xFFu << 0x18u) | color);
+        }
+    }
+}
+
+void blendPixel(UINT32 &pixel, DWORD const color, float const coverage) {
+    unsigned short const weight = static_cast<unsigned short>(coverage * 256.0f);
+
+    pixel = (0xFFu << 0x18u) |
+        (((((pixel >> 0x10u) & 0xFFu) * (256u - weight)) + (((color >> 0x10u) & 0xFFu) * weight)) >> 8u << 0x10u) |
+        (((((pixel >> 0x08u) & 0xFFu) * (256u - weight)) + (((color >> 0x08u) & 0xFFu) * weight)) >> 8u << 0x08u) |
+        (((((pixel >> 0x00u) & 0xFFu) * (256u - weight)) + (((color >> 0x00u) & 0xFFu) * weight)) >> 8u << 0x00u)
+    ;
+}
+
+/* Function > Draw Sprites ->> Renders every `SpriteKind` at the current `tileSize` */
+void drawSprites(void) {
+    unsigned short const tileBeveledSize = tileSize - tileBevelSize;
+
+    // ...
+    std::free(sprites);
+    sprites = static_cast<UINT32*>(std::malloc(spriteCount * tileSize * tileSize * sizeof(UINT32)));
+    spriteSize = NULL == sprites ? 0u : tileSize;
+
+    for (unsigned char kind = 0u; kind != spriteCount && NULL != sprites; ++kind) {
+        Framebuffer sprite = Framebuffer(sprites + (kind * spriteSize * spriteSize), spriteSize, spriteSize, spriteSize);
+
+        // ... ->> base fill
+        drawBevel(sprite, 0, 0, tileSize, tileBevelSize, (spriteCrossMatched == kind || spriteKnotMatched == kind) ? tileMatchColor : tileColor, tileBevelColor);
+
+        // ... ->> bevel outline
+        sprite.fill(tileBevelSize, tileBevelSize, tileBeveledSize, (0xFFu << 0x18u) | tileOutlineColor);
+        sprite.fill(tileBeveledSize, tileBevelSize, tileBeveledSize, (0xFFu << 0x18u) | tileOutlineColor);
+
+        for (unsigned short y = tileBevelSize; tileBeveledSize != y; ++y) {
+            sprite.fill(y, tileBevelSize, tileBevelSize + 1, (0xFFu << 0x18u) | tileOutlineColor);
+            sprite.fill(y, tileBeveledSize, tileBeveledSize + 1, (0xFFu << 0x18u) | tileOutlineColor);
+        }
+
+        /* ... */
+        if (spriteCross == kind || spriteCrossMatched == kind) {
+            float const crossThickness = 10.0f;
+            unsigned short const crossSize = (tileBeveledSize * 3u) / 5u;
+            unsigned short const crossOffset = (tileBeveledSize - crossSize) / 2u;
+            DWORD const crossColor = 0x0060FFu;
+
+            // ...
+            drawLine(sprite, crossOffset, crossOffset, crossOffset + crossSize, crossOffset + crossSize, crossThickness, crossColor, true);
+            drawLine(sprite, crossOffset + crossSize, crossOffset, crossOffset, crossOffset + crossSize, crossThickness, crossColor, true);
+        }
+
+        if (spriteKnot == kind || spriteKnotMatched == kind) {
+            float const knotCenter = (tileSize / 2u) + 0.5f;
+            DWORD const knotColor = 0xFF300Fu;
+            float const knotRadius = ((tileBeveledSize * 3u) / 5u) / /* ->> because radius */ 2u;
+            float const knotThickness = 10.0f;
+
+            // ... ->> Same band as `|radius² - distance²| < radius × thickness`
+            drawRing(sprite, knotCenter, knotCenter, std::sqrt((knotRadius * knotRadius) + (knotRadius * knotThickness)), knotRadius > knotThickness ? std::sqrt((knotRadius * knotRadius) - (knotRadius * knotThickness)) : 0.0f, knotColor, true);
+        }
+    }
+}
+
+/* Function > Profiler ... ->> Histograms & trace ring written from `Update()`; Read back for the overlay and the F5 export */
+LONG profilerCount(unsigned char const phase) {
+    LONG count = 0;
+
+    for (unsigned char bucket = profilerBucketCount; bucket--; ) count += profilerHistogram[phase][bucket];
+    return count;
+}
+
+// ... ->> Drawn over a cleared band of the framebuffer itself: only changed tiles are repainted, so text left there would otherwise accumulate
+void profilerDraw(HDC const deviceContextHandle) {
+    char text[profilerPhaseCount * 64u];
+    int length = 0;
+    RECT bounds = RECT();
+
+    for (unsigned char phase = 0u; phase != profilerPhaseCount; ++phase)
+    length += std::sprintf(text + length, "%-10s %8ld frames  p50 < %6ld us  p99 < %6ld us\n", profilerPhaseNames[phase], profilerCount(phase), profilerPercentile(phase, 50L), profilerPercentile(phase, 99L));
+
+    bounds.bottom = 8 + (profilerPhaseCount * 16);
+    bounds.left = 4;
+    bounds.right = windowFramebuffer.width;
+    bounds.top = 4;
+    windowFramebuffer.fill(0, 0, bounds.right, bounds.bottom, (0xFFu << 0x18u) | 0x000000u);
+
+    ::SetBkMode(deviceContextHandle, TRANSPARENT);
+    ::SetTextColor(deviceContextHandle, 0x00FFFFu);
+    ::DrawText(deviceContextHandle, text, length, &bounds, DT_LEFT | DT_NOCLIP | DT_TOP);
+}
+
+// ... ->> Upper bucket bound (in microseconds) of the `percent`th percentile; Zero before any sample
+LONG profilerPercentile(unsigned char const phase, LONG const percent) {
+    LONG const count = profilerCount(phase);
+
+    for (LONG bucket = 0, cumulative = 0; 0 != count && bucket != profilerBucketCount; ++bucket)
+    if ((cumulative += profilerHistogram[phase][bucket]) * 100L >= count * percent) return 1L << bucket;
+
+    return 0;
+}
+
+void profilerRecord(unsigned char const phase, LONGLONG const start, LONGLONG const end) {
+    unsigned char bucket = 0u;
+    LONGLONG const duration = ((end - start) * 1000000LL) / profilerFrequency.QuadPart;
+    ProfilerSample &sample = profilerTrace[static_cast<unsigned long>(::InterlockedIncrement(&profilerTraceCount) - 1) % (sizeof(profilerTrace) / sizeof(*profilerTrace))];
+
+    while (bucket != profilerBucketCount - 1u && duration >> bucket) ++bucket;
+    ::InterlockedIncrement(&profilerHistogram[phase][bucket]);
+
+    sample.duration = duration;
+    sample.phase = phase;
+    sample.start = (start * 1000000LL) / profilerFrequency.QuadPart;
+}
+
+// ... ->> One summary object per phase, then the trace ring as Chrome trace "complete" events (oldest first)
+bool profilerSave(char const fileName[]) {
+    unsigned long const capacity = sizeof(profilerTrace) / sizeof(*profilerTrace);
+    unsigned long const count = static_cast<unsigned long>(profilerTraceCount);
+    std::FILE *const file = std::fopen(fileName, "w");
+
+    if (NULL == file) return false;
+
+    std::fputc('{', file);
+    for (unsigned char phase = 0u; phase != profilerPhaseCount; ++phase) {
+        std::fprintf(file, "\"%s\": {\"count\": %ld, \"p50\": %ld, \"p99\": %ld, \"histogram\": [", profilerPhaseNames[phase], profilerCount(phase), profilerPercentile(phase, 50L), profilerPercentile(phase, 99L));
+        for (unsigned char bucket = 0u; bucket != profilerBucketCount; ++bucket) std::fprintf(file, "%s%ld", bucket ? ", " : "", static_cast<long>(profilerHistogram[phase][bucket]));
+        std::fputs("]}, ", file);
+    }
+
+    std::fputs("\"traceEvents\": [", file);
+    for (unsigned long first = count > capacity ? count - capacity : 0uL, index = first; index != count; ++index) {
+        ProfilerSample const &sample = profilerTrace[index % capacity];
+        std::fprintf(file, "%s{\"name\": \"%s\", \"ph\": \"X\", \"pid\": 0, \"tid\": 0, \"ts\": %lld, \"dur\": %lld}", first != index ? ", " : "", profilerPhaseNames[sample.phase], static_cast<long long>(sample.start), static_cast<long long>(sample.duration));
+    }
+
+    std::fputs("]}\n", file);
+    return 0 == std::fclose(file);
+}
+
+ProfilerTimer::ProfilerTimer(unsigned char const phase) : phase(phase), start() {
+    if (profilerEnabled) ::QueryPerformanceCounter(&start);
+}
+
+ProfilerTimer::~ProfilerTimer(void) {
+    if (profilerEnabled && 0LL != start.QuadPart) {
+        LARGE_INTEGER end;
+
+        ::QueryPerformanceCounter(&end);
+        profilerRecord(phase, start.QuadPart, end.QuadPart);
+    }
+}
+
+/* Function > Get Tile ->> Maps window coordinates to a tile index in constant time; `tiles.TILE_COUNT` for the board margins and outside */
+unsigned short getTile(int const x, int const y) {
+    unsigned short const tilesHeight = ((tileMargin * (tiles.ROW_COUNT - 1u)) + (tileSize * tiles.ROW_COUNT));
+    unsigned short const tilesWidth = ((tileMargin * (tiles.COLUMN_COUNT - 1u)) + (tileSize * tiles.COLUMN_COUNT));
+    int const horizontalDelta = x - ((windowWidth - tilesWidth) / 2);
+    int const verticalDelta = y - ((windowHeight - tilesHeight) / 2);
+
+    if (0 < horizontalDelta && 0 < verticalDelta) {
+        unsigned short const column = horizontalDelta / (tileSize + tileMargin);
+        unsigned short const row = verticalDelta / (tileSize + tileMargin);
+
+        if (
+            (column < tiles.COLUMN_COUNT && 0 != horizontalDelta % (tileSize + tileMargin) && horizontalDelta % (tileSize + tileMargin) < tileSize) &&
+            (row < tiles.ROW_COUNT && 0 != verticalDelta % (tileSize + tileMargin) && verticalDelta % (tileSize + tileMargin) < tileSize)
+        ) return column + (row * tiles.COLUMN_COUNT);
+    }
+
+    return tiles.TILE_COUNT;
+}
+
+/* Function > Loop Run ->> Blocks until a thread message, `signal` or the next fixed `tick` is due; Dispatches messages first, then `onsignal`, then every `ontick` due since */
+int loopRun(MSG &message, HANDLE const signal, bool (*const onsignal)(void), DWORD const tick, void (*const ontick)(void)) {
+    DWORD const count = NULL != signal ? 1u : 0u;
+
+    for (DWORD due = ::GetTickCount() + tick; ; ) {
+        DWORD timeout = INFINITE;
+        DWORD woken;
+
+        if (0u != tick) {
+            LONG const remaining = static_cast<LONG>(due - ::GetTickCount());
+            timeout = remaining > 0 ? static_cast<DWORD>(remaining) : 0u;
+        }
+
+        woken = ::MsgWaitForMultipleObjects(count, &signal, FALSE, timeout, QS_ALLINPUT);
+        while (FALSE != ::PeekMessage(&message, NULL, 0x0, 0x0, PM_REMOVE)) {
+            if (WM_QUIT == message.message) return static_cast<int>(message.wParam);
+            ::DispatchMessage(&message);
+        }
+
+        // ... ->> `EXIT_SUCCESS` once `onsignal` asks to stop
+        if (0u != count && WAIT_OBJECT_0 == woken && false == (*onsignal)()) return EXIT_SUCCESS;
+        if (0u != tick) for (; static_cast<LONG>(::GetTickCount() - due) >= 0; due += tick) (*ontick)();
+    }
+}
+
+/* Function > Render Run ->> `renderThread`; Sleeps until `renderSignal` is raised, then renders & presents a frame */
+DWORD WINAPI renderRun(LPVOID const) {
+    MSG message = MSG();
+
+    loopRun(message, renderSignal, &renderStep, 0u, NULL);
+    return 0u;
+}
+
+/* Function > Render Step ->> Updates & paints into the memory bitmap, then copies it to the window; `false` once `renderRunning` is cleared */
+bool renderStep(void) {
+    if (false == renderRunning) return false;
+
+    Update();
+    if (profilerEnabled) profilerDraw(windowMemoryDeviceContextHandle);
+
+    // ...
+    ::BitBlt(windowDeviceContextHandle, 0, 0, windowWidth, windowHeight, windowMemoryDeviceContextHandle, 0, 0, SRCCOPY);
+    return true;
+}
+
+/* Function > Search Reply ->> Worker; Searches its copy of the board for the computer's knot, then hands the tile to `renderThread` as `gameReply` */
+DWORD WINAPI searchReply(LPVOID const parameter) {
+    TileBoard *const board = static_cast<TileBoard*>(parameter);
+    unsigned short const move = board -> searchParallel(tileSearchDepth, false);
+
+    delete board;
+    ::InterlockedExchange(&gameReply, move);
+    ::SetEvent(renderSignal);
+
+    return 0u;
+}
+
+/* Function > Simulate ->> Worker; Plays `games` to completion with the same `Board::match(...)` test as `Update()` */
+DWORD WINAPI simulate(LPVOID const parameter) {
+    SimulatorStatistics &statistics = *static_cast<SimulatorStatistics*>(parameter);
+
+    for (unsigned long game = statistics.games; game--; ) {
+        TileBoard board = TileBoard();
+        unsigned char length = 0u;
+        bool crossing = true, matched = false;
+
+        while (false == matched && length != board.TILE_COUNT) {
+            unsigned short const tile = simulatorMove(board, crossing, statistics.policies[crossing ? 0 : 1], statistics.seed);
+
+            board.mark(tile, crossing);
+            matched = board.match(tile, false);
+
+            ++length;
+            crossing = false == crossing;
+        }
+
+        ++statistics.lengths[length];
+        if (false == matched) ++statistics.draws;
+        else if (crossing) ++statistics.knotWins; // ->> `crossing` already flipped past the winning mark
+        else ++statistics.crossWins;
+    }
+
+    return 0u;
+}
+
+/* Function > Simulator Main ->> Splits the games across one worker per processor, then reports per-worker and total results */
+int simulatorMain(char const commandLineArguments[]) {
+    unsigned long games = 1000000uL;
+    char policyNames[2][16] = {"random", "random"};
+    unsigned char policies[2] = {simulatorRandomPolicy, simulatorRandomPolicy};
+    HANDLE threads[64];
+    DWORD threadCount = 0u;
+    unsigned long threadLimit = 0uL; // ->> Zero for every processor
+    SYSTEM_INFO systemInformation;
+    LARGE_INTEGER end, frequency, start;
+    SimulatorStatistics total = SimulatorStatistics();
+
+    std::sscanf(std::strstr(commandLineArguments, "--simulate") + 10, "%lu %15s %15s %lu", &games, policyNames[0], policyNames[1], &threadLimit);
+    for (unsigned char player = 0u; player != 2u; ++player)
+    for (unsigned char policy = simulatorPolicyCount; policy--; )
+    if (0 == std::strcmp(policyNames[player], simulatorPolicyNames[policy])) policies[player] = policy;
+
+    ::GetSystemInfo(&systemInformation);
+    threadCount = systemInformation.dwNumberOfProcessors < sizeof(threads) / sizeof(*threads) ? systemInformation.dwNumberOfProcessors : sizeof(threads) / sizeof(*threads);
+    threadCount = 0uL != threadLimit && threadLimit < threadCount ? threadLimit : threadCount;
+    threadCount = 0u != threadCount ? threadCount : 1u;
+
+    simulatorStatistics = new SimulatorStatistics[threadCount];
+    solverInitiate();
+
+    // ...
+    ::QueryPerformanceFrequency(&frequency);
+    ::QueryPerformanceCounter(&start);
+
+    for (DWORD thread = 0u; thread != threadCount; ++thread) {
+        simulatorStatistics[thread] = SimulatorStatistics();
+        simulatorStatistics[thread].games = (games / threadCount) + (thread < games % threadCount);
+        simulatorStatistics[thread].policies[0] = policies[0];
+        simulatorStatistics[thread].policies[1] = policies[1];
+        simulatorStatistics[thread].seed = 0x9E3779B9u * (thread + 1u);
+
+        threads[thread] = ::CreateThread(NULL, 0u, &simulate, simulatorStatistics + thread, 0x0u, NULL);
+        if (NULL == threads[thread]) simulate(simulatorStatistics + thread);
+    }
+
+    for (DWORD thread = 0u; thread != threadCount; ++thread)
+    if (NULL != threads[thread]) { ::WaitForSingleObject(threads[thread], INFINITE); ::CloseHandle(threads[thread]); }
+
+    ::QueryPerformanceCounter(&end);
+
+    // ...
+    std::printf("%s (crosses) vs %s (knots), %lu thread(s)\n", simulatorPolicyNames[policies[0]], simulatorPolicyNames[policies[1]], threadCount);
+    for (DWORD thread = 0u; thread != threadCount; ++thread) {
+        SimulatorStatistics const &statistics = simulatorStatistics[thread];
+
+        std::printf("  thread %2lu: %10lu games, %10lu crosses, %10lu knots, %10lu draws\n", thread, statistics.games, statistics.crossWins, statistics.knotWins, statistics.draws);
+        total.crossWins += statistics.crossWins;
+        total.draws += statistics.draws;
+        total.games += statistics.games;
+        total.knotWins += statistics.knotWins;
+
+        for (unsigned char length = 0u; length != sizeof(total.lengths) / sizeof(*total.lengths); ++length)
+        total.lengths[length] += statistics.lengths[length];
+    }
+
+    if (0u != total.games) {
+        double const seconds = static_cast<double>(end.QuadPart - start.QuadPart) / static_cast<double>(frequency.QuadPart);
+
+        std::printf("crosses %6.2f%%, knots %6.2f%%, draws %6.2f%%\n", (100.0 * total.crossWins) / total.games, (100.0 * total.knotWins) / total.games, (100.0 * total.draws) / total.games);
+        for (unsigned char length = 0u; length != sizeof(total.lengths) / sizeof(*total.lengths); ++length)
+        if (0u != total.lengths[length]) std::printf("  length %u: %6.2f%%\n", length, (100.0 * total.lengths[length]) / total.games);
+
+        std::printf("%lu games in %.3f s (%.0f games/s)\n", total.games, seconds, 0.0 != seconds ? total.games / seconds : 0.0);
+    }
+
+    delete[] simulatorStatistics;
+    simulatorStatistics = NULL;
+
+    return EXIT_SUCCESS;
+}
+
+/* Function > Simulator Move ->> Random: any empty tile; Greedy: win, else block, else random; Perfect: `solverMoves` (3×3 only, greedy otherwise) */
+unsigned short simulatorMove(TileBoard &board, bool const crossing, unsigned char const policy, uint32_t &seed) {
+    unsigned short empty[TileBoard::TILE_COUNT], emptyCount = 0u;
+
+    if (simulatorPerfectPolicy == policy && 3u == board.COLUMN_COUNT && 3u == board.ROW_COUNT && 3u == board.LENGTH)
+    return solverMoves[solverTernary[board.crosses[0] & 0x1FFu] + (2u * solverTernary[board.knots[0] & 0x1FFu])];
+
+    for (unsigned short tile = 0u; tile != board.TILE_COUNT; ++tile)
+    if (false == board.isMarked(tile)) empty[emptyCount++] = tile;
+
+    // ... ->> Own winning mark first, then the opponent's
+    if (simulatorRandomPolicy != policy)
+    for (unsigned char pass = 0u; pass != 2u; ++pass)
+    for (unsigned short index = 0u; index != emptyCount; ++index) {
+        bool matched;
+
+        board.mark(empty[index], 0u == pass ? crossing : false == crossing);
+        matched = board.match(empty[index], false);
+        board.unmark(empty[index]);
+
+        if (matched) return empty[index];
+    }
+
+    // ... ->> xorshift32
+    seed ^= seed << 13u; seed ^= seed >> 17u; seed ^= seed << 5u;
+    return empty[seed % emptyCount];
+}
+
+/* Function > Solve ->> Negamax over the 3⁹ boards; Each solved board is stored under all 8 of its symmetric images */
+signed char solve(unsigned short const crosses, unsigned short const knots) {
+    unsigned short const index = solverTernary[crosses] + (2u * solverTernary[knots]);
+    unsigned char empty = 0u, move = 9u;
+    signed char score = 0;
+
+    if (0xFFu != solverMoves[index]) return solverScores[index];
+    for (unsigned char tile = 9u; tile--; ) empty += 0x000u == ((crosses | knots) & (1u << tile));
+
+    // ... ->> Crosses move first, so it is their turn whenever both players have made as many moves
+    bool const crossing = (9u - empty) % 2u == 0u;
+
+    if (0x000u != tileMatchTable[crossing ? knots : crosses]) score = -static_cast<signed char>(1u + empty);
+    else if (0u != empty) {
+        score = -0x7F;
+
+        for (unsigned char tile = 9u; tile--; )
+        if (0x000u == ((crosses | knots) & (1u << tile))) {
+            signed char const childScore = -solve(crosses | (crossing ? 1u << tile : 0x000u), knots | (crossing ? 0x000u : 1u << tile));
+            if (score < childScore) { move = tile; score = childScore; }
+        }
+    }
+
+    // ...
+    for (unsigned char symmetry = 8u; symmetry--; ) {
+        unsigned short const image = solverTernary[solverSymmetries[symmetry][crosses]] + (2u * solverTernary[solverSymmetries[symmetry][knots]]);
+
+        solverMoves[image] = 9u != move ? solverPermutations[symmetry][move] : 9u;
+        solverScores[image] = score;
+    }
+
+    return score;
+}
+
+/* Function > Solve All ->> Batch query; Writes the best tile (or `9u`) for each board */
+void solveAll(std::size_t const count, unsigned short const crosses[], unsigned short const knots[], unsigned char moves[]) {
+    for (std::size_t index = 0u; index != count; ++index)
+    moves[index] = solverMoves[solverTernary[crosses[index]] + (2u * solverTernary[knots[index]])];
+}
+
+/* Function > Solver Initiate ->> Match & symmetry tables, then every reachable board solved once */
+void solverInitiate(void) {
+    for (unsigned short mask = 512u; mask--; ) {
+        tileMatchTable[mask] = 0x000u;
+
+        for (unsigned char line = 8u; line--; )
+        if (tileLines[line] == (mask & tileLines[line])) tileMatchTable[mask] |= tileLines[line];
+    }
+
+    // ... ->> Solve every reachable board once
+    for (unsigned short mask = 512u; mask--; ) {
+        solverTernary[mask] = 0u;
+
+        for (unsigned short tile = 9u, power = 6561u; tile--; power /= 3u)
+        if (mask & (1u << tile)) solverTernary[mask] += power;
+
+        for (unsigned char symmetry = 8u; symmetry--; ) {
+            solverSymmetries[symmetry][mask] = 0x000u;
+
+            for (unsigned char tile = 9u; tile--; )
+            if (mask & (1u << tile)) solverSymmetries[symmetry][mask] |= 1u << solverPermutations[symmetry][tile];
+        }
+    }
+
+    for (unsigned short index = sizeof(solverMoves) / sizeof(*solverMoves); index--; ) solverMoves[index] = 0xFFu;
+    solve(0x000u, 0x000u);
+}
 
 /* Main */
-int WinMain(HINSTANCE const instanceHandle, HINSTANCE const previousInstanceHandle, LPSTR const /* commandLineArguments */, int const appearance) {
+int WinMain(HINSTANCE const instanceHandle, HINSTANCE const previousInstanceHandle, LPSTR const commandLineArguments, int const appearance) {
     int exitCode = EXIT_SUCCESS;
     bool instanceAlreadyRunning = false;
 
+    // ... ->> Headless modes never open a window
+    if (NULL != commandLineArguments && NULL != std::strstr(commandLineArguments, "--bench")) return benchmarkMain(commandLineArguments);
+    if (NULL != commandLineArguments && NULL != std::strstr(commandLineArguments, "--simulate")) return simulatorMain(commandLineArguments);
+
     // ...
     if (NULL != previousInstanceHandle) instanceAlreadyRunning = true;
     else {
@@ -483,14 +1509,9 @@ int WinMain(HINSTANCE const instanceHandle, HINSTANCE const previousInstanceHand
             if (NULL == windowHandle) exitCode = EXIT_FAILURE;
             else {
                 MSG threadMessage = MSG();
-                BOOL threadMessageAvailable = TRUE;
-
-                while (FALSE == threadMessageAvailable || WM_QUIT != threadMessage.message) {
-                    ::DispatchMessage(&threadMessage);
-                    threadMessageAvailable = ::PeekMessage(&threadMessage, NULL, 0x0, 0x0, PM_REMOVE);
-                }
 
-                exitCode = threadMessage.wParam;
+                // ... ->> Blocks until input arrives; The board only changes in response to input, so there is no tick
+                exitCode = loopRun(threadMessage, NULL, NULL, 0u, NULL);
             }
 
             ::UnregisterClass(windowClassInformation.lpszClassName, windowClassInformation.hInstance);